@@ -0,0 +1,164 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the append-only file, which adds data to the end of a file
+ * without ever rewriting what is already there.
+ */
+
+#include "AppendOnlyFile.h"
+
+using namespace std;
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+AppendOnlyFile::AppendOnlyFile() {
+    mFd = -1;
+    mPolicy = SyncPolicy::NEVER;
+}
+
+AppendOnlyFile::~AppendOnlyFile() {
+    close();
+}
+
+bool AppendOnlyFile::open( const char* PATH, const SyncPolicy POLICY ) {
+    close();
+
+#ifdef _WIN32
+    mFd = _open( PATH, _O_RDWR | _O_APPEND | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE );
+#else
+    mFd = ::open( PATH, O_RDWR | O_APPEND | O_CREAT, 0644 );
+#endif
+
+    if( mFd < 0 ) {
+        return false;
+    }
+
+    mPolicy = POLICY;
+    return true;
+}
+
+bool AppendOnlyFile::getSize( unsigned long& size ) const {
+#ifdef _WIN32
+    struct _stat status;
+    if( mFd < 0 || _fstat( mFd, &status ) != 0 ) {
+        return false;
+    }
+#else
+    struct stat status;
+    if( mFd < 0 || fstat( mFd, &status ) != 0 ) {
+        return false;
+    }
+#endif
+
+    size = status.st_size;
+    return true;
+}
+
+bool AppendOnlyFile::read( const unsigned long OFFSET, void* pData, const unsigned long SIZE ) const {
+    if( mFd < 0 ) {
+        return false;
+    }
+
+#ifdef _WIN32
+    // Appends do not depend on the position, so it can be moved freely
+    if( _lseek( mFd, OFFSET, SEEK_SET ) < 0 ) {
+        return false;
+    }
+    return _read( mFd, pData, SIZE ) == (long) SIZE;
+#else
+    return pread( mFd, pData, SIZE, OFFSET ) == (long) SIZE;
+#endif
+}
+
+bool AppendOnlyFile::truncate( const unsigned long SIZE ) {
+    if( mFd < 0 ) {
+        return false;
+    }
+
+#ifdef _WIN32
+    return _chsize( mFd, SIZE ) == 0;
+#else
+    return ftruncate( mFd, SIZE ) == 0;
+#endif
+}
+
+bool AppendOnlyFile::append( const void* pData, const unsigned long SIZE ) {
+    if( mFd < 0 ) {
+        return false;
+    }
+
+    // Appends are meant to be small, so anything short of a complete write
+    // is treated as a failure rather than retried. Whatever did make it to
+    // the file is incomplete, and is found and dropped by its reader.
+#ifdef _WIN32
+    const long WRITTEN = _write( mFd, pData, SIZE );
+#else
+    const long WRITTEN = write( mFd, pData, SIZE );
+#endif
+
+    if( WRITTEN != (long) SIZE ) {
+        return false;
+    }
+
+    if( mPolicy == SyncPolicy::EVERY_APPEND ) {
+        return sync();
+    }
+
+    return true;
+}
+
+bool AppendOnlyFile::sync() {
+    if( mFd < 0 ) {
+        return false;
+    }
+
+#ifdef _WIN32
+    return _commit( mFd ) == 0;
+#else
+    return fsync( mFd ) == 0;
+#endif
+}
+
+void AppendOnlyFile::close() {
+    if( mFd < 0 ) {
+        return;
+    }
+
+    if( mPolicy == SyncPolicy::ON_CLOSE ) {
+        sync();
+    }
+
+#ifdef _WIN32
+    _close( mFd );
+#else
+    ::close( mFd );
+#endif
+
+    mFd = -1;
+}
+
+bool AppendOnlyFile::isOpen() const {
+    return mFd >= 0;
+}
@@ -0,0 +1,112 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the append-only file, which adds data to the end of a file
+ * without ever rewriting what is already there.
+ */
+
+#ifndef APPEND_ONLY_FILE_H
+#define APPEND_ONLY_FILE_H
+
+#include "SyncPolicy.h"
+
+/**
+ * @brief A file that is only ever written to at its end. Every append is
+ * a single write, so a crash can at worst leave the last append partially
+ * written, and never damages earlier data. Appends always go to the end of
+ * the file as it is at the time, even when other processes append to it too
+ */
+class AppendOnlyFile final {
+public:
+    /**
+     * @brief Create an append-only file with no file open
+     */
+    AppendOnlyFile();
+
+    /**
+     * @brief Close the file, if any
+     */
+    ~AppendOnlyFile();
+
+    AppendOnlyFile( const AppendOnlyFile& ) = delete;
+    AppendOnlyFile& operator=( const AppendOnlyFile& ) = delete;
+
+    /**
+     * @brief Open a file for appending, replacing any file that is
+     * currently open. The file is created if it does not exist
+     * @param PATH The path of the file
+     * @param POLICY When appended data is forced out to disk
+     * @return true if the file was opened, false otherwise
+     */
+    bool open( const char* PATH, const SyncPolicy POLICY );
+
+    /**
+     * @brief Get the current size of the file
+     * @param size Set to the size of the file in bytes
+     * @return true if the size was found, false otherwise
+     */
+    bool getSize( unsigned long& size ) const;
+
+    /**
+     * @brief Read data back from the file
+     * @param OFFSET The position of the data in the file
+     * @param pData The destination of the data
+     * @param SIZE The size of the data in bytes
+     * @return true if all of the data was read, false otherwise
+     */
+    bool read( const unsigned long OFFSET, void* pData, const unsigned long SIZE ) const;
+
+    /**
+     * @brief Cut the file down to a given size, such as to remove a
+     * partially written append
+     * @param SIZE The new size of the file
+     * @return true if the file was cut, false otherwise
+     */
+    bool truncate( const unsigned long SIZE );
+
+    /**
+     * @brief Write data to the end of the file
+     * @param pData The data to write
+     * @param SIZE The size of the data in bytes
+     * @return true if all of the data was written, false otherwise
+     */
+    bool append( const void* pData, const unsigned long SIZE );
+
+    /**
+     * @brief Force every append out to disk
+     * @return true if the data was synced, false otherwise
+     */
+    bool sync();
+
+    /**
+     * @brief Close the file, syncing it first if the policy asks for it
+     */
+    void close();
+
+    /**
+     * @brief Check if a file is open
+     * @return true if a file is open, false otherwise
+     */
+    bool isOpen() const;
+
+private:
+    int mFd;
+    SyncPolicy mPolicy;
+};
+
+#endif
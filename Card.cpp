@@ -24,72 +24,9 @@
 #include "CardSuit.h"
 #include "CardRank.h"
 
-using namespace sf;
+// Tables are used at runtime, so they still need a definition
+constexpr unsigned char Card::RANKS[];
+constexpr unsigned char Card::SUITS[];
+constexpr bool Card::COLORS[];
 
-Card::Card() : Card::Card( true ) {
-    // Aliased to hidden card
-}
-
-Card::Card( const CardSuit SUIT, const CardRank RANK ) {
-    mSuit = SUIT;
-    mRank = RANK;
-}
-
-Card::Card( const CardSuit SUIT ) {
-    mSuit = SUIT;
-
-    // Overload the rank so that the calculated texture will be
-    // at the empty placeholder portion of the spritesheet.
-    // This is extremeley stupid, but I did this before I learned
-    // that composition would be more suitable for this task
-    mRank = (CardRank)(CardRank::KING + 1);
-}
-
-Card::Card( const bool HIDDEN ) {
-    if( HIDDEN ) {
-        mSuit = CardSuit::CLUBS;
-    } else {
-        mSuit = CardSuit::SPADES;
-    }
-
-    // Overload the rank so that the calculated texture will be 
-    // at the face down/empty placeholder portion of the spritesheet.
-    // This is extremeley stupid, but I did this before I learned
-    // that composition would be more suitable for this task
-    mRank = (CardRank)(CardRank::KING + 2);
-}
-
-CardRank Card::getRank() const {
-    return mRank;
-}
-
-CardSuit Card::getSuit() const {
-    return mSuit;
-}
-
-bool Card::getColor() const {
-    // Suits are already organized by color where black suits are 
-    // first. So, if the suit is higher than spades, we can confirm
-    // that the card is red.
-    return mSuit > CardSuit::SPADES;
-}
-
-void Card::intoVertices( VertexArray& vertices, const Vector2i POS ) const {
-    // Instead of sprites or shapes, we use the lower-level vertex array
-    // SFML API instead. This is because loading an individual texture
-    // and sprite for each card is incredibly in-efficient, and so it
-    // would be better to keep a single spritesheet texture in memory
-    // and then crop it to a particular type of card when drawing them.
-    // This is a job best suited for VertexArray compared to Sprite or
-    // Shape.
-    vertices[0].position = Vector2f( POS.x, POS.y );
-    vertices[1].position = Vector2f( POS.x + WIDTH, POS.y );
-    vertices[2].position = Vector2f( POS.x + WIDTH, POS.y + HEIGHT );
-    vertices[3].position = Vector2f( POS.x, POS.y + HEIGHT );
-
-    const Vector2f TEX_POS( mRank * WIDTH, mSuit * HEIGHT );
-    vertices[0].texCoords = Vector2f( TEX_POS.x, TEX_POS.y );
-    vertices[1].texCoords = Vector2f( TEX_POS.x + WIDTH, TEX_POS.y );
-    vertices[2].texCoords = Vector2f( TEX_POS.x + WIDTH, TEX_POS.y + HEIGHT );
-    vertices[3].texCoords = Vector2f( TEX_POS.x, TEX_POS.y + HEIGHT );
-}
+static_assert( sizeof( Card ) == 1, "Cards must be a single byte" );
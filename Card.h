@@ -22,90 +22,161 @@
 #ifndef CARD_H
 #define CARD_H
 
-#include <SFML/Graphics.hpp>
-
 #include "CardRank.h"
 #include "CardSuit.h"
 
 /**
- * @brief A playing card. Can be a data object to use in other
- * game elements, or a decorative element. Cards are not game
- * elements on their own, and must be loaded into a vertex array
- * with an externally provided position in order to be drawn
+ * @brief A playing card. Cards are a single byte, where the
+ * rank and suit are encoded as RANK * 4 + SUIT and decoded
+ * through lookup tables. The accessors are defined in this
+ * header, so that rule checks compile down to table lookups.
+ * Cards are not game elements on their own, and must be wrapped
+ * in a CardSprite in order to be drawn
  */
 class Card final {
 public:
 	/**
-	 * @brief The width of a card when displayed, in pixels
+	 * @brief The amount of distinct cards
 	 */
-	static const unsigned int WIDTH = 64;
+	static const unsigned int AMOUNT = (CardSuit::DIAMONDS + 1) * (CardRank::KING + 1);
 
 	/**
-	 * @brief The height of a card when displayed, in pixels
+	 * @brief Create the ace of clubs, equivelent to
+	 * Card( CardSuit::CLUBS, CardRank::ACE ). Mostly useful
+	 * for filling arrays of cards
 	 */
-	static const unsigned int HEIGHT = 96;
+	constexpr Card();
 
 	/**
-	 * @brief Construct a "face down" card with no suit or rank,
-	 * equivelent to Card( true ). Solely for decorative purposes
+	 * @brief Create a card with a suit and rank.
+	 * @param SUIT The suit desired
+	 * @param RANK The rank desired
 	 */
-	Card();
+	constexpr Card( const CardSuit SUIT, const CardRank RANK );
 
 	/**
-	 * @brief Create a card with no suit or rank. Solely for
-	 * decorative purposes
-	 * @param FACE_DOWN Whether this card is face down.
-	 * If false, the card will be displayed as a placeholder
+	 * @brief Get the suit of this card 
+	 * @return The suit of the card
 	 */
-	Card( const bool HIDDEN );
+	constexpr CardSuit getSuit() const;
 
 	/**
-	 * @brief Create a card with a suit, but no rank. The card
-	 * will be displayed as a placeholder, but with the iconography
-	 * of the given suit. Solely for decorative purposes
-	 * @param SUIT The suit desired
+	 * @brief Get the rank of this card
+	 * @return The rank of the card
 	 */
-	Card( const CardSuit SUIT );
+	constexpr CardRank getRank() const;
 
 	/**
-	 * @brief Create a card with a suit and rank.
-	 * @param SUIT The suit desired
-	 * @param RANK The rank desired
+	 * @brief Get the color of this card
+	 * @return true if the card is red, false if the card is black
 	 */
-	Card( const CardSuit SUIT, const CardRank RANK );
+	constexpr bool getColor() const;
 
 	/**
-	 * @brief Get the suit of this card 
-	 * @return The suit of the card. If the card does not have
-	 * a suit, the behavior is undefined
+	 * @brief Get the index of this card
+	 * @return A value in the range [0, AMOUNT) that is unique to
+	 * the suit and rank of this card
 	 */
-	CardSuit getSuit() const;
+	constexpr unsigned int getIndex() const;
 
 	/**
-	 * @brief Get the rank of this card
-	 * @return The rank of the card. If the card does not have
-	 * a rank, the behavior is undefined
+	 * @brief Check if this card can be stacked on another card in a
+	 * column, i.e it is one rank lower and of the opposite color
+	 * @param OTHER The card that this card would be placed on
+	 * @return true if the card can be stacked, false otherwise
 	 */
-	CardRank getRank() const;
+	constexpr bool canStackOn( const Card OTHER ) const;
 
+private:
 	/**
-	 * @brief Get the color of this card
-	 * @return true if the card is red, false if the card is black.
-	 * If the card does not have a suit, the behavior is undefined
+	 * @brief The rank of every card index
 	 */
-	bool getColor() const;
+	static constexpr unsigned char RANKS[AMOUNT] = {
+		0, 0, 0, 0,
+		1, 1, 1, 1,
+		2, 2, 2, 2,
+		3, 3, 3, 3,
+		4, 4, 4, 4,
+		5, 5, 5, 5,
+		6, 6, 6, 6,
+		7, 7, 7, 7,
+		8, 8, 8, 8,
+		9, 9, 9, 9,
+		10, 10, 10, 10,
+		11, 11, 11, 11,
+		12, 12, 12, 12
+	};
 
 	/**
-	 * @brief Modify the given vertices to have the bounds and texture
-	 * of the card at the given position
-	 * @param vertices The vertices to modify
-	 * @param POS The position the card should be at
+	 * @brief The suit of every card index
 	 */
-	void intoVertices( sf::VertexArray& vertices, const sf::Vector2i POS ) const;
+	static constexpr unsigned char SUITS[AMOUNT] = {
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3,
+		0, 1, 2, 3
+	};
 
-private:
-	CardSuit mSuit;
-	CardRank mRank;
+	/**
+	 * @brief The color of every card index. Suits are already organized
+	 * by color where black suits are first, so this is the upper bit of
+	 * the suit.
+	 */
+	static constexpr bool COLORS[AMOUNT] = {
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true,
+		false, false, true, true
+	};
+
+	unsigned char mIndex;
 };
 
+constexpr Card::Card() : mIndex( 0 ) {
+}
+
+constexpr Card::Card( const CardSuit SUIT, const CardRank RANK ) 
+	: mIndex( RANK * (CardSuit::DIAMONDS + 1) + SUIT ) {
+}
+
+constexpr CardRank Card::getRank() const {
+	return (CardRank) RANKS[mIndex];
+}
+
+constexpr CardSuit Card::getSuit() const {
+	return (CardSuit) SUITS[mIndex];
+}
+
+constexpr bool Card::getColor() const {
+	return COLORS[mIndex];
+}
+
+constexpr unsigned int Card::getIndex() const {
+	return mIndex;
+}
+
+constexpr bool Card::canStackOn( const Card OTHER ) const {
+	// Non-short-circuiting operators keep this free of branches
+	return ( RANKS[OTHER.mIndex] - RANKS[mIndex] == 1 ) 
+		& ( COLORS[OTHER.mIndex] != COLORS[mIndex] );
+}
+
 #endif
\ No newline at end of file
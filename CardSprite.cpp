@@ -0,0 +1,64 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * functionality of the card sprite, which maps cards onto the card spritesheet.
+ */
+
+#include "CardSprite.h"
+
+using namespace sf;
+
+// Tables are used at runtime, so they still need a definition
+constexpr unsigned short CardSprite::TEX_X[];
+constexpr unsigned short CardSprite::TEX_Y[];
+
+CardSprite::CardSprite( const Card CARD ) {
+    mIndex = CARD.getIndex();
+}
+
+CardSprite::CardSprite( const bool HIDDEN ) {
+    if( HIDDEN ) {
+        mIndex = BACK;
+    } else {
+        mIndex = PLACEHOLDER;
+    }
+}
+
+CardSprite::CardSprite( const CardSuit SUIT ) {
+    mIndex = Card::AMOUNT + SUIT;
+}
+
+void CardSprite::intoVertices( Vertex* pVertices, const Vector2i POS ) const {
+    // Instead of sprites or shapes, we use the lower-level vertex array
+    // SFML API instead. This is because loading an individual texture
+    // and sprite for each card is incredibly in-efficient, and so it
+    // would be better to keep a single spritesheet texture in memory
+    // and then crop it to a particular type of card when drawing them.
+    // This is a job best suited for VertexArray compared to Sprite or
+    // Shape.
+    pVertices[0].position = Vector2f( POS.x, POS.y );
+    pVertices[1].position = Vector2f( POS.x + WIDTH, POS.y );
+    pVertices[2].position = Vector2f( POS.x + WIDTH, POS.y + HEIGHT );
+    pVertices[3].position = Vector2f( POS.x, POS.y + HEIGHT );
+
+    const Vector2f TEX_POS( TEX_X[mIndex], TEX_Y[mIndex] );
+    pVertices[0].texCoords = Vector2f( TEX_POS.x, TEX_POS.y );
+    pVertices[1].texCoords = Vector2f( TEX_POS.x + WIDTH, TEX_POS.y );
+    pVertices[2].texCoords = Vector2f( TEX_POS.x + WIDTH, TEX_POS.y + HEIGHT );
+    pVertices[3].texCoords = Vector2f( TEX_POS.x, TEX_POS.y + HEIGHT );
+}
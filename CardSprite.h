@@ -0,0 +1,144 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * interface of the card sprite, which maps cards onto the card spritesheet.
+ */
+
+#ifndef CARD_SPRITE_H
+#define CARD_SPRITE_H
+
+#include <SFML/Graphics.hpp>
+
+#include "Card.h"
+#include "CardSuit.h"
+
+/**
+ * @brief The displayed form of a card, or of a decorative element
+ * such as the back of a card or a placeholder. Sprites are not drawn
+ * on their own, and must be loaded into a quad of a vertex array with
+ * an externally provided position in order to be drawn
+ */
+class CardSprite final {
+public:
+    /**
+     * @brief The width of a card when displayed, in pixels
+     */
+    static const unsigned int WIDTH = 64;
+
+    /**
+     * @brief The height of a card when displayed, in pixels
+     */
+    static const unsigned int HEIGHT = 96;
+
+    /**
+     * @brief Create a sprite for the face of the given card
+     * @param CARD The card to display
+     */
+    CardSprite( const Card CARD );
+
+    /**
+     * @brief Create a sprite with no suit or rank. Solely for
+     * decorative purposes
+     * @param HIDDEN Whether this sprite is the back of a card.
+     * If false, the sprite will be displayed as a placeholder
+     */
+    CardSprite( const bool HIDDEN );
+
+    /**
+     * @brief Create a placeholder sprite with the iconography of
+     * the given suit. Solely for decorative purposes
+     * @param SUIT The suit desired
+     */
+    CardSprite( const CardSuit SUIT );
+
+    /**
+     * @brief Modify the given vertices to have the bounds and texture
+     * of the card at the given position
+     * @param pVertices The four vertices of the quad to modify, which
+     * may be part of a larger vertex array
+     * @param POS The position the card should be at
+     */
+    void intoVertices( sf::Vertex* pVertices, const sf::Vector2i POS ) const;
+
+private:
+    /**
+     * @brief The amount of distinct sprites. Every card face comes first,
+     * in the order of their card indices, followed by a placeholder for
+     * every suit, the back of a card, and an empty placeholder
+     */
+    static const unsigned int AMOUNT = Card::AMOUNT + (CardSuit::DIAMONDS + 1) + 2;
+
+    /**
+     * @brief The sprite of the back of a card
+     */
+    static const unsigned char BACK = AMOUNT - 2;
+
+    /**
+     * @brief The sprite of an empty placeholder
+     */
+    static const unsigned char PLACEHOLDER = AMOUNT - 1;
+
+    /**
+     * @brief The left edge of every sprite within the spritesheet, which
+     * has a column for every rank, then a column of suit placeholders, and
+     * then a column containing the back of a card and an empty placeholder
+     */
+    static constexpr unsigned short TEX_X[AMOUNT] = {
+        0, 0, 0, 0,
+        64, 64, 64, 64,
+        128, 128, 128, 128,
+        192, 192, 192, 192,
+        256, 256, 256, 256,
+        320, 320, 320, 320,
+        384, 384, 384, 384,
+        448, 448, 448, 448,
+        512, 512, 512, 512,
+        576, 576, 576, 576,
+        640, 640, 640, 640,
+        704, 704, 704, 704,
+        768, 768, 768, 768,
+        832, 832, 832, 832,
+        896, 896
+    };
+
+    /**
+     * @brief The top edge of every sprite within the spritesheet, which has
+     * a row for every suit
+     */
+    static constexpr unsigned short TEX_Y[AMOUNT] = {
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96, 192, 288,
+        0, 96
+    };
+
+    unsigned char mIndex;
+};
+
+#endif
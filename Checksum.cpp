@@ -0,0 +1,34 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the checksum function, which detects damaged data in the
+ * files written by the game.
+ */
+
+#include "Checksum.h"
+
+uint32_t computeChecksum( const void* pData, const size_t SIZE ) {
+    const uint8_t* pBytes = static_cast<const uint8_t*>( pData );
+    uint32_t hash = 2166136261u;
+    for( size_t i = 0; i < SIZE; ++i ) {
+        hash ^= pBytes[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
@@ -22,175 +22,66 @@
 
 #include "Column.h"
 
-using namespace sf;
 using namespace std;
 
-#include <cmath>
-
-Column::Column( const unsigned int NUMBER, Deck& deck ) {
+Column::Column( GameState& state, const unsigned int NUMBER ) {
+    mPState = &state;
+    mPile = (Pile) (Pile::COLUMN + NUMBER);
     mNumber = NUMBER;
+}
 
-    // Initialize the column with cards from the deck such
+void Column::deal() {
+    // Initialize the column with cards from the stock such
     // that each column has one more card than the previous
-    while( mHiddenCards.size() <= (unsigned int) mNumber ) {
-        mHiddenCards.push_back( deck.pull() );
+    while( getTotalCount() <= mNumber ) {
+        mPState->move( Pile::STOCK, 1, mPile );
     }
+    mPState->setHiddenCount( mNumber, getTotalCount() );
 
     // Reveal only the first card initially 
-    mReveal();
+    reveal();
 }
 
-bool Column::click( const Vector2i MOUSE_POS, Selection*& pSelection ) {
-    IntRect selectionBounds;
-    list<Card>::const_iterator selectionIter = mShownCards.begin();
-
-    // What cards we select depends on where in the shown cards the mouse
-    // clicked.
-    unsigned int i;
-    for( i = mHiddenCards.size(); i < mGetTotalCards(); ++i ) {
-        const IntRect BOUNDS = mGetBoundsAt( i );
-        if( BOUNDS.contains( MOUSE_POS ) ) {
-            // Found a card that is within the mouse bounds, select this
-            // card
-            selectionBounds = BOUNDS;
-            break;
-        }
-
-        ++selectionIter;
-    }
-
-    if( i < mGetTotalCards() ) {
-        // Select the card that was clicked on *and* any following cards
-        list<Card> cards;
-        cards.splice( 
-            cards.begin(), 
-            mShownCards, selectionIter, mShownCards.end() 
-        );
-
-        pSelection = new Selection( 
-            mGetId(),
-            Vector2i( selectionBounds.left, selectionBounds.top ), 
-            MOUSE_POS,
-            cards
-        );
-    }
-
-    // If the loop was terminated by the inequality, we didn't find a card 
-
-    return false;
+unsigned int Column::getHiddenCount() const {
+    return mPState->getHiddenCount( mNumber );
 }
 
-void Column::release( Selection*& pSelection ) {
-    if( pSelection->isConsumed() ) {
-        // Consumed, reveal a new card if needed
-        mReveal();
-    } else {
-        // Not consumed, return it to this instance
-        pSelection->consume( mShownCards, mShownCards.end() );
-    }
-
-    delete pSelection;
-    pSelection = nullptr;
+unsigned int Column::getTotalCount() const {
+    return mPState->getSize( mPile );
 }
 
-void Column::drop( Selection& selection ) {
-    if( selection.getId() == mGetId() ) {
-        // This column created the selection, avoid a
-        // superfluous move
-        return;
-    }
+Card Column::getCardAt( const unsigned int IDX ) const {
+    return mPState->getCards( mPile )[IDX];
+}
 
-    if( !selection.intersects( mGetTotalBounds() ) ) {
-        // Not in bounds
-        return;
-    }
+bool Column::canTake( const unsigned int COUNT ) const {
+    // Any amount of shown cards can be taken, as they are always
+    // ordered by the rules in canPut
+    return COUNT > 0 && COUNT <= getTotalCount() - getHiddenCount();
+}
 
-    const Card TOP = selection.getTop();
+Card Column::peek( const unsigned int COUNT ) const {
+    return getCardAt( getTotalCount() - COUNT );
+}
 
+bool Column::canPut( const Card CARD, const unsigned int COUNT ) const {
     // Cards added to a column must be in descending order (King to Ace) 
     // and alternating in color (Black to Red and vice versa)
-    if( mShownCards.size() > 0 ) {
-        const Card BOTTOM = mShownCards.back();
-        const bool IS_ALTERNATING = TOP.getColor() != BOTTOM.getColor();
-        const bool IS_DESCENDING = TOP.getRank() == BOTTOM.getRank() - 1;
-        if( !IS_ALTERNATING || !IS_DESCENDING ) {
-            return;
-        }
-    } else if( TOP.getRank() != CardRank::KING ) {
-        return;
+    if( getTotalCount() > getHiddenCount() ) {
+        return CARD.canStackOn( getCardAt( getTotalCount() - 1 ) );
     }
 
-    selection.consume( mShownCards, mShownCards.end() );
+    // Only kings can be placed in empty columns
+    return getTotalCount() == 0 && CARD.getRank() == CardRank::KING;
 }
 
-void Column::draw( RenderTarget& target, RenderStates states ) const {
-    VertexArray vertices( Quads, 4 );
-
-    // Use a placeholder when drawing all hidden cards
-    unsigned int i;
-    const Card HIDDEN;
-    for( i = 0; i < mHiddenCards.size(); ++i) {
-        const IntRect BOUNDS = mGetBoundsAt( i );
-        HIDDEN.intoVertices( vertices, Vector2i( BOUNDS.left, BOUNDS.top ) );
-        target.draw( vertices, states );
-    }
-
-    // Draw the remaining shown cards afterwards
-    for( Card card : mShownCards ) { 
-        const IntRect BOUNDS = mGetBoundsAt( i );
-        card.intoVertices( vertices, Vector2i( BOUNDS.left, BOUNDS.top ) );
-        target.draw( vertices, states );
-        ++i;
-    }
-}
-
-void Column::mReveal() {
-    if( mHiddenCards.size() == 0 || mShownCards.size() > 0 ) {
+void Column::reveal() {
+    const unsigned int HIDDEN = getHiddenCount();
+    if( HIDDEN == 0 || getTotalCount() > HIDDEN ) {
         // No hidden cards/multiple shown cards, we shouldn't
         // reveal anything
         return;
     }
 
-    mShownCards.push_back( mHiddenCards.back() );
-    mHiddenCards.pop_back();
-}
-
-unsigned int Column::mGetId() const {
-    return (mNumber + 1) << AMOUNT;
-}
-
-unsigned int Column::mGetTotalCards() const {
-    return mHiddenCards.size() + mShownCards.size();
-}
-
-IntRect Column::mGetTotalBounds() const {
-    return IntRect(
-        16 + mNumber * (Card::WIDTH + 16),
-        32 + Card::HEIGHT,
-        Card::WIDTH,
-        // Total card amount is unsigned, so we want to make sure
-        // we don't underflow with empty columns and create absurdly
-        // tall bounds
-        Card::HEIGHT + 24 * min(mGetTotalCards() - 1, mGetTotalCards())
-    );
-}
-
-IntRect Column::mGetBoundsAt( const unsigned int IDX ) const {
-    IntRect bounds(
-        16 + mNumber * (Card::WIDTH + 16),
-        32 + (Card::HEIGHT + 24 * IDX),
-        Card::WIDTH,
-        Card::HEIGHT
-    );
-
-    // Cards that are not at the bottom of a column are only
-    // 24 pixels tall instead of the typical card height,
-    // so this must be reflected in the bounds as well
-    const bool IS_MULTIPLE = mGetTotalCards() > 1;
-    const bool IS_BEHIND = IDX < mGetTotalCards() - 1 ;
-    if( IS_MULTIPLE && IS_BEHIND ) {
-        bounds.height = 24;
-    }
-
-    return bounds;
+    mPState->setHiddenCount( mNumber, HIDDEN - 1 );
 }
@@ -23,80 +23,94 @@
 #ifndef COLUMN_H
 #define COLUMN_H
 
-#include <SFML/Graphics.hpp>
-
-#include <list>
-
 #include "Card.h"
-#include "Deck.h"
-#include "IDroppable.h"
-#include "Selection.h"
+#include "GameState.h"
+#include "Pile.h"
 
 /**
  * @brief The Column solitaire game element. Cards must be re-arranged
- * between these in order to complete the game
+ * between these in order to complete the game. This is a view over a
+ * column of a game state
  */
-class Column final : public sf::Drawable, public IDroppable {
+class Column final {
 public:
     /**
      * @brief The amount of columns in a solitaire game
      */
-    static const unsigned int AMOUNT = 7;
+    static const unsigned int AMOUNT = GameState::COLUMN_AMOUNT;
 
     /**
-     * @brief Create a column populated from the given deck
-     * @param NUMBER The number of the deck, in the range 
-     * [0, AMOUNT]. This controls where the column is
-     * placed and how many cards it will initially have
-     * @param deck The deck to populate the column from
+     * @brief Create a view over a column of a game state
+     * @param state The state to view
+     * @param NUMBER The number of the column, in the range 
+     * [0, AMOUNT). This controls how many cards it will
+     * initially be dealt
      */
-    Column( const unsigned int NUMBER, Deck& deck );
+    Column( GameState& state, const unsigned int NUMBER );
 
-    bool click( const sf::Vector2i MOUSE_POS, Selection*& pSelection ) override;
-    void release( Selection*& pSelection ) override;
-    
-    void drop( Selection& selection ) override;
+    /**
+     * @brief Deal the initial cards of this column from the top of
+     * the stock, such that each column has one more card than the
+     * previous
+     */
+    void deal();
 
-    void draw( sf::RenderTarget& target, sf::RenderStates states ) const override;
+    /**
+     * @brief Get the amount of hidden cards in this column
+     * @return The amount of face down cards
+     */
+    unsigned int getHiddenCount() const;
 
-private:
-    std::list<Card> mHiddenCards;
-    std::list<Card> mShownCards;
-    int mNumber;
+    /**
+     * @brief Get the total amount of cards in this column
+     * @return The combined amount of hidden and shown cards
+     */
+    unsigned int getTotalCount() const;
 
     /**
-     * @brief Reveals the bottom hidden card if there are no shown cards in
-     * this column.
+     * @brief Get a card in this column
+     * @param IDX The index of the card, in the range [0, getTotalCount()),
+     * where the first getHiddenCount() cards are hidden
+     * @return The card at IDX
      */
-    void mReveal();
+    Card getCardAt( const unsigned int IDX ) const;
 
     /**
-     * @brief Get the selection ID of this column
-     * @return A unique selection ID
+     * @brief Check if cards can be taken from this column
+     * @param COUNT The amount of cards to take from the bottom of the
+     * column
+     * @return true if the cards can be taken, false otherwise
      */
-    unsigned int mGetId() const;
+    bool canTake( const unsigned int COUNT ) const;
 
     /**
-     * @brief Get the total amount of cards in this column
-     * @return The combined amount of hidden and shown cards
+     * @brief Get the card that would lead a selection of cards taken from
+     * this column
+     * @param COUNT The amount of cards that would be taken. This must be
+     * allowed by canTake
+     * @return The leading card of the selection
      */
-    unsigned int mGetTotalCards() const;
+    Card peek( const unsigned int COUNT ) const;
 
     /**
-     * @brief Get the bounds of the entire column
-     * @return A rect representing the bounds of the column
-     * as is displayed in the window
+     * @brief Check if cards taken from another element can be placed on
+     * this column
+     * @param CARD The leading card of the taken cards
+     * @param COUNT The amount of taken cards
+     * @return true if the cards can be placed, false otherwise
      */
-    sf::IntRect mGetTotalBounds() const;
+    bool canPut( const Card CARD, const unsigned int COUNT ) const;
 
     /**
-     * @brief Get the bounds of a particular card at IDX
-     * @param IDX The index of the card to retrive the bounds
-     * from, in the range [0, TOTAL_CARDS)
-     * @return A rect representing the bounds of the desired
-     * card as is displayed in the window
+     * @brief Reveals the bottom hidden card if there are no shown cards in
+     * this column. This should be called after cards are taken
      */
-    sf::IntRect mGetBoundsAt( const unsigned int IDX ) const;
+    void reveal();
+
+private:
+    GameState* mPState;
+    Pile mPile;
+    unsigned int mNumber;
 };
 
-#endif
\ No newline at end of file
+#endif
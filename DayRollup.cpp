@@ -0,0 +1,83 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the Day Rollup data structure, which totals the games started
+ * on a single day.
+ */
+
+#include "DayRollup.h"
+
+#include <cstring>
+
+static const int64_t SECONDS_PER_HOUR = 60 * 60;
+static const int64_t SECONDS_PER_DAY = SECONDS_PER_HOUR * 24;
+
+int64_t DayRollup::getDay( const int64_t TIME ) {
+    // Division rounds towards zero, but days before 1970 still have to
+    // start at midnight
+    if( TIME < 0 ) {
+        return (TIME + 1) / SECONDS_PER_DAY - 1;
+    }
+
+    return TIME / SECONDS_PER_DAY;
+}
+
+DayRollup DayRollup::empty( const int64_t DAY ) {
+    DayRollup rollup;
+    memset( &rollup, 0, sizeof( rollup ) );
+    rollup.day = DAY;
+    return rollup;
+}
+
+void DayRollup::add( const SolitaireInfo INFO ) {
+    const unsigned int HOUR = (INFO.startTime - getDay( INFO.startTime ) * SECONDS_PER_DAY) / SECONDS_PER_HOUR;
+    ++games;
+    ++hourGames[HOUR];
+
+    if( INFO.win ) {
+        if( wins == 0 || INFO.getDuration() < shortestWinDuration ) {
+            shortestWinDuration = INFO.getDuration();
+        }
+
+        if( wins == 0 || INFO.moves < smallestWinMoves ) {
+            smallestWinMoves = INFO.moves;
+        }
+
+        ++wins;
+        ++hourWins[HOUR];
+    }
+}
+
+void DayRollup::merge( const DayRollup& OTHER ) {
+    if( OTHER.wins > 0 ) {
+        if( wins == 0 || OTHER.shortestWinDuration < shortestWinDuration ) {
+            shortestWinDuration = OTHER.shortestWinDuration;
+        }
+
+        if( wins == 0 || OTHER.smallestWinMoves < smallestWinMoves ) {
+            smallestWinMoves = OTHER.smallestWinMoves;
+        }
+    }
+
+    games += OTHER.games;
+    wins += OTHER.wins;
+    for( unsigned int i = 0; i < 24; ++i ) {
+        hourGames[i] += OTHER.hourGames[i];
+        hourWins[i] += OTHER.hourWins[i];
+    }
+}
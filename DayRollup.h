@@ -0,0 +1,107 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the Day Rollup data structure, which totals the games started on
+ * a single day.
+ */
+
+#ifndef DAY_ROLLUP_H
+#define DAY_ROLLUP_H
+
+#include <cstdint>
+
+#include "SolitaireInfo.h"
+
+/**
+ * @brief The totals of the games started within some range of days, which
+ * is a single day when stored in the history index. Days and hours are in
+ * UTC. Every field has a fixed width, so that rollups can be stored in
+ * files as they are
+ */
+struct DayRollup {
+    /**
+     * @brief The day, counted from January 1st 1970. Rollups of several
+     * days have the first of them
+     */
+    int64_t day;
+
+    /**
+     * @brief The amount of games that were played
+     */
+    uint32_t games;
+
+    /**
+     * @brief The amount of those games that were won
+     */
+    uint32_t wins;
+
+    /**
+     * @brief The shortest time it took to win a game, in seconds
+     */
+    int64_t shortestWinDuration;
+
+    /**
+     * @brief The smallest amount of moves it took to win a game
+     */
+    uint32_t smallestWinMoves;
+
+    /**
+     * @brief Unused space, always written as zero
+     */
+    uint32_t reserved;
+
+    /**
+     * @brief The amount of games that were started in each hour of the day
+     */
+    uint32_t hourGames[24];
+
+    /**
+     * @brief The amount of games that were won for each hour of the day
+     */
+    uint32_t hourWins[24];
+
+    /**
+     * @brief Find the day a point in time is on
+     * @param TIME The time, in seconds since January 1st 1970
+     * @return The day, counted from January 1st 1970
+     */
+    static int64_t getDay( const int64_t TIME );
+
+    /**
+     * @brief Create a rollup with no games
+     * @param DAY The day of the rollup
+     * @return An empty rollup
+     */
+    static DayRollup empty( const int64_t DAY );
+
+    /**
+     * @brief Add a game to the rollup
+     * @param INFO The game to add
+     */
+    void add( const SolitaireInfo INFO );
+
+    /**
+     * @brief Add every game of another rollup to this rollup
+     * @param OTHER The rollup to merge
+     */
+    void merge( const DayRollup& OTHER );
+};
+
+static_assert( sizeof( DayRollup ) == 224, "Day rollups must not have padding" );
+
+#endif
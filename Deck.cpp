@@ -22,126 +22,56 @@
 
 #include "Deck.h"
 
-using namespace sf;
 using namespace std;
 
-#include "CardRank.h"
-#include "CardSuit.h"
+#include "Random.h"
 
-#include <cstdlib>
-
-Deck::Deck() {
-    const unsigned int DECK_SIZE = (CardSuit::DIAMONDS + 1) * (CardRank::KING + 1);
+Deck::Deck( GameState& state ) {
+    mPState = &state;
+}
 
-    // Initially create an ordered array for the deck. This allows the
-    // shuffling  process to be much more efficient compared to immediately
-    // using a linked list
-    Card** initDeck = new Card*[DECK_SIZE];
-    for( unsigned int i = 0; i < DECK_SIZE; ++i ) {
-        initDeck[i] = new Card( 
-            (CardSuit) (i % (CardSuit::DIAMONDS + 1)), 
-            (CardRank) (i % (CardRank::KING + 1)) 
-        );
-    }
+void Deck::shuffle( const uint64_t SEED ) {
+    const unsigned int SIZE = getHiddenCount();
 
-    // Shuffle the deck SIZE * 2 times to ensure a high level of randomness
-    for( unsigned int i = 0; i < DECK_SIZE * 2; ++i ) {
-        const int FROM = rand() % DECK_SIZE;
-        const int TO = rand() % DECK_SIZE;
-        Card* pCard = initDeck[FROM];
-        initDeck[FROM] = initDeck[TO];
-        initDeck[TO] = pCard;
+    // Fisher-Yates shuffle, where each card is swapped with a uniformly
+    // chosen card at or below it. This makes every order equally likely
+    Random random( SEED );
+    for( unsigned int i = SIZE; i > 1; --i ) {
+        mPState->swap( Pile::STOCK, i - 1, random.nextBelow( i ) );
     }
+}
 
-    // Convert the card array to a linked list to be used in this instance
-    for( unsigned int i = 0; i < DECK_SIZE; ++i ) {
-    	mHiddenCards.push_back( *initDeck[i] );
-    	delete initDeck[i];
+void Deck::turn() {
+    if( getHiddenCount() > 0 ) {
+        // Moving a card from the top of the hidden cards to the top of the
+        // revealed cards allows the ordering of the whole deck to be
+        // preserved
+        mPState->move( Pile::STOCK, 1, Pile::WASTE );
+    } else {
+        // Flip the revealed cards over to replenish the hidden cards, so
+        // that they are drawn again in the same order
+        mPState->reverse( Pile::WASTE );
+        mPState->move( Pile::WASTE, getRevealedCount(), Pile::STOCK );
     }
-
-    delete[] initDeck;
-
-    // The deck consists of two elements, one for cards that have not been
-    // drawn and cards that are drawn. These are placed placed in the top
-    // left corner
-    mHiddenBounds = IntRect( 16, 16, Card::WIDTH, Card::HEIGHT );
-    mRevealedBounds = IntRect( 32 + Card::WIDTH, 16, Card::WIDTH, Card::HEIGHT );
 }
 
-Card Deck::pull() {
-    // Simply take the top hidden card. We assume that this function is
-    // called by other code and not triggered by any user input, thus
-    // validation is not needed
-    Card card = mHiddenCards.back();
-    mHiddenCards.pop_back();
-    return card;
+unsigned int Deck::getHiddenCount() const {
+    return mPState->getSize( Pile::STOCK );
 }
 
-bool Deck::click( const Vector2i MOUSE_POS, Selection*& pSelection ) {
-    if( mHiddenBounds.contains( MOUSE_POS ) ) {
-        // Clicked the hidden portion of the deck, draw a card
-        if( mHiddenCards.size() > 0 ) {
-            // Moving a card from the *back* of the hidden cards to the *front*
-            // of the revealed cards allows the ordering of the whole deck to
-            // be preserved
-            mRevealedCards.push_front( mHiddenCards.back() );
-            mHiddenCards.pop_back();
-        } else {
-            // Swap the two card lists to replenish the hidden cards
-            mHiddenCards = mRevealedCards;
-            mRevealedCards = list<Card>();
-        }
-
-        // Drawing is considered a move
-        return true; 
-    }
-
-    if( mRevealedBounds.contains( MOUSE_POS ) && mRevealedCards.size() > 0 ) {
-        // Clicked the revealed portion of the deck, select the top revealed card
-        list<Card> cards;
-        cards.splice( 
-            cards.begin(), 
-            mRevealedCards, mRevealedCards.begin(), ++mRevealedCards.begin() 
-        );
-
-        pSelection = new Selection( 
-            0,
-            Vector2i( mRevealedBounds.left, mRevealedBounds.top ), 
-            MOUSE_POS,
-            cards
-        );
-    }
-
-    return false;
+unsigned int Deck::getRevealedCount() const {
+    return mPState->getSize( Pile::WASTE );
 }
 
-void Deck::release( Selection*& pSelection ) {
-    if( !pSelection->isConsumed() ) {
-        // Not consumed, return to deck
-        pSelection->consume( mRevealedCards, mRevealedCards.begin() );
-    }
-
-    delete pSelection;
-    pSelection = nullptr;    
+Card Deck::getRevealedAt( const unsigned int IDX ) const {
+    return mPState->getCards( Pile::WASTE )[IDX];
 }
 
-void Deck::draw( RenderTarget& target, RenderStates states ) const {
-    VertexArray vertices( Quads, 4 );
-
-    // Always show a placeholder for the hidden portion of the deck
-    Card hidden( mHiddenCards.size() > 0 );
-
-    hidden.intoVertices( vertices, sf::Vector2i( mHiddenBounds.left, mHiddenBounds.top ) );
-    target.draw( vertices, states );
-
-    // Show the top (front) shown card if available
-    Card top;
-    if( mRevealedCards.size() > 0 ) {
-        top = mRevealedCards.front();
-    } else {
-        top = Card( false );
-    }
+bool Deck::canTake( const unsigned int COUNT ) const {
+    // Only the top revealed card can be taken
+    return COUNT == 1 && getRevealedCount() > 0;
+}
 
-    top.intoVertices( vertices, Vector2i( mRevealedBounds.left, mRevealedBounds.top ) );
-    target.draw( vertices, states );
-}
\ No newline at end of file
+Card Deck::peek( const unsigned int COUNT ) const {
+    return getRevealedAt( getRevealedCount() - 1 );
+}
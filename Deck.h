@@ -23,43 +23,81 @@
 #ifndef DECK_H
 #define DECK_H
 
-#include <SFML/Graphics.hpp>
-
-#include <list>
+#include <cstdint>
 
 #include "Card.h"
-#include "ISelectable.h"
-#include "Selection.h"
+#include "GameState.h"
 
 /**
  * @brief The Deck solitaire game element. This is where cards
- * are drawn from
+ * are drawn from. The hidden portion of the deck is the stock,
+ * while the revealed portion is the waste. This is a view over
+ * the stock and waste of a game state
  */
-class Deck final : public sf::Drawable, public ISelectable {
+class Deck final {
 public:
+    /**
+     * @brief The amount of cards in a deck
+     */
+    static const unsigned int SIZE = GameState::CARD_AMOUNT;
+
+    /**
+     * @brief Create a view over the deck of a game state
+     * @param state The state to view
+     */
+    Deck( GameState& state );
 
     /**
-     * @brief Create a new shuffled deck
+     * @brief Shuffle the hidden portion of the deck. The same seed always
+     * produces the same order from the same initial order
+     * @param SEED The seed of the shuffle
      */
-    Deck();
+    void shuffle( const uint64_t SEED );
 
     /**
-     * @brief Pull a card from the deck so that other game elements can
-     * be seeded with cards
-     * @return A card from the top of the "hidden" portion of the deck
+     * @brief Turn over the top hidden card onto the revealed cards, or
+     * return every revealed card to the hidden cards if there are no
+     * hidden cards left
      */
-    Card pull();
+    void turn();
 
-    bool click( const sf::Vector2i MOUSE_POS, Selection*& pSelection ) override;
-    void release( Selection*& pSelection ) override;
+    /**
+     * @brief Get the amount of hidden cards in the deck
+     * @return The size of the hidden portion of the deck
+     */
+    unsigned int getHiddenCount() const;
 
-    void draw( sf::RenderTarget& target, sf::RenderStates states ) const override;
+    /**
+     * @brief Get the amount of revealed cards in the deck
+     * @return The size of the revealed portion of the deck
+     */
+    unsigned int getRevealedCount() const;
+
+    /**
+     * @brief Get a revealed card
+     * @param IDX The index of the card, in the range [0, getRevealedCount()),
+     * where the last index is the top of the revealed cards
+     * @return The card at IDX
+     */
+    Card getRevealedAt( const unsigned int IDX ) const;
+
+    /**
+     * @brief Check if cards can be taken from the revealed cards
+     * @param COUNT The amount of cards to take
+     * @return true if the cards can be taken, false otherwise
+     */
+    bool canTake( const unsigned int COUNT ) const;
+
+    /**
+     * @brief Get the card that would lead a selection of revealed cards
+     * @param COUNT The amount of cards that would be taken. This must be
+     * allowed by canTake
+     * @return The leading card of the selection
+     */
+    Card peek( const unsigned int COUNT ) const;
 
 private:
-    std::list<Card> mHiddenCards;
-    std::list<Card> mRevealedCards;
-    sf::IntRect mHiddenBounds;
-    sf::IntRect mRevealedBounds;
+    GameState* mPState;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -16,30 +16,27 @@
  * - Confirmed proper project formatting from Professor Paone
  *
  * This program implements a game of klondike solitaire. This file implements the
- * the Droppable game element interface, which allows elements to accept Cards
- * that were dragged and dropped onto it.
+ * the interface of the Export Format enum, which decides how exported history
+ * games are written.
  */
 
-#ifndef DROPPABLE_H
-#define DROPPABLE_H
-
-#include "ISelectable.h"
-#include "Selection.h"
+#ifndef EXPORT_FORMAT_H
+#define EXPORT_FORMAT_H
 
 /**
- * @brief An game element that selections can be dropped on
+ * @brief How games are written when exporting the history, each of which
+ * has one line per game so that it can be read as it is written
  */
-class IDroppable : public ISelectable {
-public:
-    virtual ~IDroppable() {}
+enum ExportFormat {
+    /**
+     * @brief Comma separated values, with a line naming the columns first
+     */
+    CSV = 0,
 
     /**
-     * @brief Called when a selection from another element is attempting to be
-     * dropped on this element
-     * @param selection The selection. This can be consumed by the element,
-     * but not deleted.
+     * @brief A JSON object per line, with a field for each column
      */
-    virtual void drop( Selection& selection ) = 0;
+    JSON_LINES = 1
 };
 
-#endif
\ No newline at end of file
+#endif
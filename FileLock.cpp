@@ -0,0 +1,126 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the file lock, which lets separate processes take turns
+ * changing the same files.
+ */
+
+#include "FileLock.h"
+
+using namespace std;
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+FileLock::FileLock() {
+    mFd = -1;
+}
+
+FileLock::~FileLock() {
+    unlock();
+}
+
+bool FileLock::lock( const char* PATH ) {
+    unlock();
+
+#ifdef _WIN32
+    mFd = _open( PATH, _O_RDWR | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE );
+    if( mFd < 0 ) {
+        return false;
+    }
+
+    // Only the first byte is locked, which is enough as every process
+    // locks the same byte
+    OVERLAPPED overlapped = {};
+    const HANDLE FILE_HANDLE = (HANDLE) _get_osfhandle( mFd );
+    const bool LOCKED = LockFileEx( FILE_HANDLE, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped );
+#else
+    mFd = ::open( PATH, O_RDWR | O_CREAT, 0644 );
+    if( mFd < 0 ) {
+        return false;
+    }
+
+    // Waiting for the lock can be interrupted by signals, which is not a
+    // reason to give up on it
+    int result;
+    do {
+        result = flock( mFd, LOCK_EX );
+    } while( result != 0 && errno == EINTR );
+    const bool LOCKED = result == 0;
+#endif
+
+    if( !LOCKED ) {
+#ifdef _WIN32
+        _close( mFd );
+#else
+        ::close( mFd );
+#endif
+        mFd = -1;
+    }
+
+    return LOCKED;
+}
+
+void FileLock::unlock() {
+    if( mFd < 0 ) {
+        return;
+    }
+
+    // Closing the file releases the lock
+#ifdef _WIN32
+    _close( mFd );
+#else
+    ::close( mFd );
+#endif
+
+    mFd = -1;
+}
+
+bool FileLock::read( void* pData, const unsigned long SIZE ) const {
+    if( mFd < 0 ) {
+        return false;
+    }
+
+#ifdef _WIN32
+    return _lseek( mFd, 0, SEEK_SET ) == 0 && _read( mFd, pData, SIZE ) == (long) SIZE;
+#else
+    return pread( mFd, pData, SIZE, 0 ) == (long) SIZE;
+#endif
+}
+
+bool FileLock::write( const void* pData, const unsigned long SIZE ) {
+    if( mFd < 0 ) {
+        return false;
+    }
+
+#ifdef _WIN32
+    return _lseek( mFd, 0, SEEK_SET ) == 0 && _write( mFd, pData, SIZE ) == (long) SIZE;
+#else
+    return pwrite( mFd, pData, SIZE, 0 ) == (long) SIZE;
+#endif
+}
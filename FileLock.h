@@ -0,0 +1,81 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the file lock, which lets separate processes take turns changing
+ * the same files.
+ */
+
+#ifndef FILE_LOCK_H
+#define FILE_LOCK_H
+
+/**
+ * @brief An exclusive lock on a lock file, which only one process can hold
+ * at a time. Processes that agree to hold it while changing some other
+ * files can then never change them at the same time. The lock file can
+ * also hold a little data of its own, which is only read and written while
+ * holding the lock
+ */
+class FileLock final {
+public:
+    /**
+     * @brief Create a file lock that is not held
+     */
+    FileLock();
+
+    /**
+     * @brief Release the lock, if it is held
+     */
+    ~FileLock();
+
+    FileLock( const FileLock& ) = delete;
+    FileLock& operator=( const FileLock& ) = delete;
+
+    /**
+     * @brief Take the lock, waiting for any other process holding it to
+     * release it first. The lock file is created if it does not exist
+     * @param PATH The path of the lock file
+     * @return true if the lock is now held, false otherwise
+     */
+    bool lock( const char* PATH );
+
+    /**
+     * @brief Release the lock, if it is held
+     */
+    void unlock();
+
+    /**
+     * @brief Read the data held by the lock file
+     * @param pData The destination of the data
+     * @param SIZE The size of the data in bytes
+     * @return true if the lock file held that much data, false otherwise
+     */
+    bool read( void* pData, const unsigned long SIZE ) const;
+
+    /**
+     * @brief Replace the data held by the lock file
+     * @param pData The data to write
+     * @param SIZE The size of the data in bytes
+     * @return true if all of the data was written, false otherwise
+     */
+    bool write( const void* pData, const unsigned long SIZE );
+
+private:
+    int mFd;
+};
+
+#endif
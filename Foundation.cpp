@@ -22,111 +22,55 @@
 
 #include "Foundation.h"
 
-using namespace sf;
 using namespace std;
 
-Foundation::Foundation( const CardSuit SUIT ) {
+Foundation::Foundation( GameState& state, const CardSuit SUIT ) {
+    mPState = &state;
     mSuit = SUIT;
+    mPile = (Pile) (Pile::FOUNDATION + SUIT);
+}
 
-    // Place foundations within the top right of the window
-    mBounds = IntRect( 
-        16 + (Card::WIDTH + 16) * (3 + mSuit), 
-        16, Card::WIDTH, Card::HEIGHT 
-    );
+CardSuit Foundation::getSuit() const {
+    return mSuit;
 }
 
 bool Foundation::isComplete() const {
-    if( mCards.size() > 0 ) { 
-        // We already establish that any cards added must follow
-        // an ascending ordering, so if the rank of the top of
-        // the foundation is a king, we must be complete
-        return mCards.back().getRank() == CardRank::KING;
-    }
-
-    return false;
+    // We already establish that any cards added must follow
+    // an ascending ordering, so a foundation with as many cards
+    // as there are ranks must be complete
+    return getCount() == CardRank::KING + 1;
 }
 
-bool Foundation::click( const Vector2i MOUSE_POS, Selection*& pSelection ) {
-    if( mBounds.contains( MOUSE_POS ) && mCards.size() > 0 ) {
-        // Can select this foundation, move the top card into a selection
-        list<Card> cards;
-        cards.splice( 
-            cards.begin(), 
-            mCards, --mCards.end(), mCards.end() 
-        );
-
-        pSelection = new Selection( 
-            mGetId(),
-            Vector2i( mBounds.left, mBounds.top ), 
-            MOUSE_POS,
-            cards
-        );
-    }
-
-    return false;
+unsigned int Foundation::getCount() const {
+    return mPState->getSize( mPile );
 }
 
-void Foundation::release( Selection*& pSelection ) {
-    if( !pSelection->isConsumed() ) {
-        // Not consumed, return to foundation
-        pSelection->consume( mCards, mCards.end() );
-    }
-
-    delete pSelection;
-    pSelection = nullptr;
+Card Foundation::getTop() const {
+    return mPState->getCards( mPile )[getCount() - 1];
 }
 
-void Foundation::drop( Selection& selection ) {
-    if( selection.getId() == mGetId() ) {
-        // This foundation created the selection, avoid a
-        // superfluous move
-        return;
-    }
+bool Foundation::canTake( const unsigned int COUNT ) const {
+    // Only the top card can be taken back out of the foundation
+    return COUNT == 1 && getCount() > 0;
+}
 
-    if( !selection.intersects( mBounds ) ) {
-        // Not in bounds
-        return;
-    }
+Card Foundation::peek( const unsigned int COUNT ) const {
+    return getTop();
+}
 
-    if( selection.hasMultipleCards() ) {
+bool Foundation::canPut( const Card CARD, const unsigned int COUNT ) const {
+    if( COUNT > 1 ) {
         // Foundations can only be built one card at a time
-        return;
+        return false;
     }
 
     // Cards added to the foundation must be of the same suit
-    const Card CARD = selection.getTop();
     if( CARD.getSuit() != mSuit ) {
-        return;
-    }
-
-    // Cards must be added to the foundation in ascending order (King -> Ace)
-    const bool IS_STARTING = mCards.size() == 0 
-        && CARD.getRank() == CardRank::ACE;
-    const bool IS_CONTINUING = mCards.size() > 0 
-        && CARD.getRank() == mCards.back().getRank() + 1;
-    if( !IS_STARTING && !IS_CONTINUING ) {
-        return;
-    }
-
-    selection.consume( mCards, mCards.end() );
-}
-
-void Foundation::draw( RenderTarget& target, RenderStates states ) const {
-    VertexArray vertices( Quads, 4 );
-
-    Card top;
-    if( mCards.size() > 0 ) {
-        // We have cards, show the uppermost card
-        top = mCards.back();
-    } else {
-        // No cards, show an empty placeholder
-        top = Card( mSuit );
+        return false;
     }
 
-    top.intoVertices( vertices, Vector2i( mBounds.left, mBounds.top ) );
-    target.draw( vertices, states );
-}
-
-unsigned int Foundation::mGetId() const {
-    return (mSuit + 1) << AMOUNT;
+    // Cards must be added to the foundation in ascending order (Ace -> King).
+    // As the suit already matches, the foundation's size is the only rank
+    // that can continue it.
+    return CARD.getRank() == (int) getCount();
 }
@@ -23,20 +23,17 @@
 #ifndef FOUNDATION_H
 #define FOUNDATION_H
 
-#include <SFML/Graphics.hpp>
-
-#include <list>
-
 #include "Card.h"
 #include "CardSuit.h"
-#include "IDroppable.h"
-#include "Selection.h"
+#include "GameState.h"
+#include "Pile.h"
 
 /**
  * @brief The Foundation solitaire game element. This is where
- * cards are placed in order to complete the game
+ * cards are placed in order to complete the game. This is a view
+ * over a foundation of a game state
  */
-class Foundation final : public sf::Drawable, public IDroppable {
+class Foundation final {
 public:
     /**
      * @brief The amount of foundations in a solitaire game
@@ -44,10 +41,17 @@ public:
     static const unsigned int AMOUNT = CardSuit::DIAMONDS + 1;
 
     /**
-     * @brief Create a foundation
+     * @brief Create a view over a foundation of a game state
+     * @param state The state to view
      * @param SUIT The suit of the cards that should be placed in this foundation
      */
-    Foundation( const CardSuit SUIT );
+    Foundation( GameState& state, const CardSuit SUIT );
+
+    /**
+     * @brief Get the suit of this foundation
+     * @return The suit of the cards that are placed in this foundation
+     */
+    CardSuit getSuit() const;
 
     /**
      * @brief Get if this foundation is complete
@@ -56,23 +60,48 @@ public:
      */
     bool isComplete() const;
 
-    bool click( const sf::Vector2i MOUSE_POS, Selection*& pSelection ) override;
-    void release( Selection*& pSelection ) override;
+    /**
+     * @brief Get the amount of cards in this foundation
+     * @return The amount of cards placed in this foundation
+     */
+    unsigned int getCount() const;
 
-    void drop( Selection& selection ) override;
+    /**
+     * @brief Get the top card of this foundation
+     * @return The uppermost card. If the foundation is empty, the behavior
+     * is undefined
+     */
+    Card getTop() const;
 
-    void draw( sf::RenderTarget& target, sf::RenderStates states ) const override;
+    /**
+     * @brief Check if cards can be taken from this foundation
+     * @param COUNT The amount of cards to take
+     * @return true if the cards can be taken, false otherwise
+     */
+    bool canTake( const unsigned int COUNT ) const;
 
-private:
-    CardSuit mSuit;
-    std::list<Card> mCards;
-    sf::IntRect mBounds;
+    /**
+     * @brief Get the card that would lead a selection of cards taken from
+     * this foundation
+     * @param COUNT The amount of cards that would be taken. This must be
+     * allowed by canTake
+     * @return The leading card of the selection
+     */
+    Card peek( const unsigned int COUNT ) const;
 
     /**
-     * @brief Get the selection ID for this foundation
-     * @return A unique selection ID
+     * @brief Check if cards taken from another element can be placed on
+     * this foundation
+     * @param CARD The leading card of the taken cards
+     * @param COUNT The amount of taken cards
+     * @return true if the cards can be placed, false otherwise
      */
-    unsigned int mGetId() const;
+    bool canPut( const Card CARD, const unsigned int COUNT ) const;
+
+private:
+    GameState* mPState;
+    CardSuit mSuit;
+    Pile mPile;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,170 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the game state, which stores every card of a game in a
+ * single flat array so that positions can be cheaply copied.
+ */
+
+#include "GameState.h"
+
+using namespace std;
+
+#include <algorithm>
+#include <type_traits>
+
+#include "CardRank.h"
+#include "CardSuit.h"
+#include "Random.h"
+
+static_assert( 
+    is_trivially_copyable<GameState>::value, 
+    "Game states must be copyable with memcpy" 
+);
+
+/**
+ * @brief The random keys that make up the hash of a state. A card is keyed
+ * by its pile and by its index within that pile separately, which keeps
+ * the tables small while still giving every placement a distinct key.
+ * Hidden counts are keyed by column and count
+ */
+struct ZobristKeys {
+    uint64_t piles[GameState::CARD_AMOUNT][Pile::PILE_AMOUNT];
+    uint64_t indices[GameState::CARD_AMOUNT][GameState::CARD_AMOUNT];
+    uint64_t hiddenCounts[GameState::COLUMN_AMOUNT][GameState::CARD_AMOUNT + 1];
+
+    /**
+     * @brief Fill the tables from a fixed seed, so that hashes are the
+     * same in every run
+     */
+    ZobristKeys() {
+        Random random( 0x5a0b71575eedULL );
+        for( unsigned int i = 0; i < GameState::CARD_AMOUNT; ++i ) {
+            for( unsigned int j = 0; j < Pile::PILE_AMOUNT; ++j ) {
+                piles[i][j] = random.next();
+            }
+
+            for( unsigned int j = 0; j < GameState::CARD_AMOUNT; ++j ) {
+                indices[i][j] = random.next();
+            }
+        }
+
+        for( unsigned int i = 0; i < GameState::COLUMN_AMOUNT; ++i ) {
+            for( unsigned int j = 0; j <= GameState::CARD_AMOUNT; ++j ) {
+                hiddenCounts[i][j] = random.next();
+            }
+        }
+    }
+};
+
+static const ZobristKeys KEYS;
+
+GameState::GameState() {
+    for( unsigned int i = 0; i < CARD_AMOUNT; ++i ) {
+        mCards[i] = Card( 
+            (CardSuit) (i / (CardRank::KING + 1)), 
+            (CardRank) (i % (CardRank::KING + 1)) 
+        );
+    }
+
+    // Every pile other than the stock starts out empty
+    mStarts[Pile::STOCK] = 0;
+    for( unsigned int i = Pile::WASTE; i <= Pile::PILE_AMOUNT; ++i ) {
+        mStarts[i] = CARD_AMOUNT;
+    }
+
+    mHash = 0;
+    mToggleCards( Pile::STOCK, 0, CARD_AMOUNT );
+    for( unsigned int i = 0; i < COLUMN_AMOUNT; ++i ) {
+        mHiddenCounts[i] = 0;
+        mHash ^= KEYS.hiddenCounts[i][0];
+    }
+}
+
+unsigned int GameState::getSize( const Pile PILE ) const {
+    return mStarts[PILE + 1] - mStarts[PILE];
+}
+
+const Card* GameState::getCards( const Pile PILE ) const {
+    return mCards + mStarts[PILE];
+}
+
+unsigned int GameState::getHiddenCount( const unsigned int NUMBER ) const {
+    return mHiddenCounts[NUMBER];
+}
+
+void GameState::setHiddenCount( const unsigned int NUMBER, const unsigned int COUNT ) {
+    mHash ^= KEYS.hiddenCounts[NUMBER][mHiddenCounts[NUMBER]];
+    mHiddenCounts[NUMBER] = COUNT;
+    mHash ^= KEYS.hiddenCounts[NUMBER][COUNT];
+}
+
+void GameState::move( const Pile FROM, const unsigned int COUNT, const Pile TO ) {
+    // As piles are stored back to back, moving cards is a rotation of
+    // every card between the top of the two piles, after which the
+    // boundaries of the piles in between shift over by COUNT. Only the
+    // moved cards change their pile and index, so only they are rehashed
+    const unsigned int FROM_SIZE = getSize( FROM );
+    const unsigned int TO_SIZE = getSize( TO );
+    mToggleCards( FROM, FROM_SIZE - COUNT, COUNT );
+
+    Card* pFromEnd = mCards + mStarts[FROM + 1];
+    Card* pToEnd = mCards + mStarts[TO + 1];
+
+    if( FROM < TO ) {
+        rotate( pFromEnd - COUNT, pFromEnd, pToEnd );
+        for( unsigned int i = FROM + 1; i <= (unsigned int) TO; ++i ) {
+            mStarts[i] -= COUNT;
+        }
+    } else {
+        rotate( pToEnd, pFromEnd - COUNT, pFromEnd );
+        for( unsigned int i = TO + 1; i <= (unsigned int) FROM; ++i ) {
+            mStarts[i] += COUNT;
+        }
+    }
+
+    mToggleCards( TO, TO_SIZE, COUNT );
+}
+
+void GameState::swap( const Pile PILE, const unsigned int A, const unsigned int B ) {
+    mToggleCards( PILE, A, 1 );
+    mToggleCards( PILE, B, 1 );
+    std::swap( mCards[mStarts[PILE] + A], mCards[mStarts[PILE] + B] );
+    mToggleCards( PILE, A, 1 );
+    mToggleCards( PILE, B, 1 );
+}
+
+void GameState::reverse( const Pile PILE ) {
+    const unsigned int SIZE = getSize( PILE );
+    mToggleCards( PILE, 0, SIZE );
+    std::reverse( mCards + mStarts[PILE], mCards + mStarts[PILE + 1] );
+    mToggleCards( PILE, 0, SIZE );
+}
+
+uint64_t GameState::getHash() const {
+    return mHash;
+}
+
+void GameState::mToggleCards( const Pile PILE, const unsigned int FIRST, const unsigned int COUNT ) {
+    // XOR is its own inverse, so the same toggle both adds cards to the
+    // hash and removes them again
+    const Card* pCards = mCards + mStarts[PILE];
+    for( unsigned int i = FIRST; i < FIRST + COUNT; ++i ) {
+        const unsigned int CARD = pCards[i].getIndex();
+        mHash ^= KEYS.piles[CARD][PILE] ^ KEYS.indices[CARD][i];
+    }
+}
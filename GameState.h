@@ -0,0 +1,137 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the game state, which stores every card of a game in a single
+ * flat array so that positions can be cheaply copied.
+ */
+
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+#include <cstdint>
+
+#include "Card.h"
+#include "Pile.h"
+
+/**
+ * @brief The placement of every card in a solitaire game. All cards are
+ * stored back to back in Pile order, with the top of each pile being the
+ * last card of its range. This has no pointers or heap storage, so copying
+ * a position is a single memcpy. Game elements such as Deck, Column and
+ * Foundation are views that apply the rules on top of this state.
+ *
+ * A Zobrist hash of the position is kept alongside the cards, and is
+ * updated by every change to the state, so that it is always available
+ * without looking at the cards.
+ */
+class GameState final {
+public:
+    /**
+     * @brief The amount of cards in a game
+     */
+    static const unsigned int CARD_AMOUNT = Card::AMOUNT;
+
+    /**
+     * @brief The amount of columns tracked by the state
+     */
+    static const unsigned int COLUMN_AMOUNT = Pile::PILE_AMOUNT - Pile::COLUMN;
+
+    /**
+     * @brief Create a state where every card is in the stock, ordered by
+     * suit and rank
+     */
+    GameState();
+
+    /**
+     * @brief Get the amount of cards in a pile
+     * @param PILE The pile to check
+     * @return The amount of cards in the pile
+     */
+    unsigned int getSize( const Pile PILE ) const;
+
+    /**
+     * @brief Get the cards of a pile
+     * @param PILE The pile to get
+     * @return A pointer to the bottom card of the pile, followed by the
+     * remaining getSize( PILE ) - 1 cards of the pile. This is only
+     * valid until the next move
+     */
+    const Card* getCards( const Pile PILE ) const;
+
+    /**
+     * @brief Get the amount of face down cards in a column
+     * @param NUMBER The number of the column, in the range [0, COLUMN_AMOUNT)
+     * @return The amount of cards at the bottom of the column that are
+     * face down
+     */
+    unsigned int getHiddenCount( const unsigned int NUMBER ) const;
+
+    /**
+     * @brief Set the amount of face down cards in a column
+     * @param NUMBER The number of the column, in the range [0, COLUMN_AMOUNT)
+     * @param COUNT The new amount of face down cards
+     */
+    void setHiddenCount( const unsigned int NUMBER, const unsigned int COUNT );
+
+    /**
+     * @brief Move cards from the top of one pile to the top of another,
+     * keeping their order. No rules are checked
+     * @param FROM The pile to take the cards from
+     * @param COUNT The amount of cards to move, at most getSize( FROM )
+     * @param TO The pile to place the cards on
+     */
+    void move( const Pile FROM, const unsigned int COUNT, const Pile TO );
+
+    /**
+     * @brief Swap two cards within a pile
+     * @param PILE The pile containing the cards
+     * @param A The index of the first card, in the range [0, getSize( PILE ))
+     * @param B The index of the second card, in the range [0, getSize( PILE ))
+     */
+    void swap( const Pile PILE, const unsigned int A, const unsigned int B );
+
+    /**
+     * @brief Reverse the order of the cards in a pile
+     * @param PILE The pile to reverse
+     */
+    void reverse( const Pile PILE );
+
+    /**
+     * @brief Get a hash of this state. Equal states always have equal
+     * hashes, so this can be used to key positions in a table. The hash
+     * is maintained as the state changes, so this takes constant time
+     * @return A 64-bit hash of the placement of every card
+     */
+    uint64_t getHash() const;
+
+private:
+    uint64_t mHash;
+    Card mCards[CARD_AMOUNT];
+    unsigned char mStarts[Pile::PILE_AMOUNT + 1];
+    unsigned char mHiddenCounts[COLUMN_AMOUNT];
+
+    /**
+     * @brief Toggle the cards of a range of a pile in the hash
+     * @param PILE The pile containing the cards
+     * @param FIRST The index of the first card to toggle
+     * @param COUNT The amount of cards to toggle
+     */
+    void mToggleCards( const Pile PILE, const unsigned int FIRST, const unsigned int COUNT );
+};
+
+#endif
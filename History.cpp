@@ -21,119 +21,792 @@
 
 #include "History.h"
 
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <thread>
 using namespace std;
 
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "Checksum.h"
+#include "FileLock.h"
+#include "HistoryHeader.h"
+#include "StatisticsSnapshot.h"
+#include "StatisticsSummary.h"
+
+// Binary history files start with this, which text files never do
+static const char MAGIC[4] = { 'S', 'L', 'H', 'S' };
+
+static const char* const HISTORY_PATH = "data/history.dat";
+static const char* const HISTORY_TEMP_PATH = "data/history.dat.tmp";
+static const char* const STATISTICS_PATH = "data/statistics.dat";
+static const char* const STATISTICS_TEMP_PATH = "data/statistics.dat.tmp";
+static const char* const LOCK_PATH = "data/history.lock";
+
+// Archived games are kept in files named after how many games were archived
+// once they were added, which are the raw records of those games and the
+// statistics of every archived game
+static const char* const SEGMENT_PATH_PREFIX = "data/history-";
+static const char* const ARCHIVE_PATH_PREFIX = "data/archive-";
+
+// Games are only archived once the history file has this many that are
+// old enough, so that the file is not rewritten for every game
+static const unsigned long MIN_COMPACTION_GAMES = 4096;
+static const unsigned int DEFAULT_COMPACTION_HORIZON = 365;
+
+// Games held in memory are written out as records this many at a time
+static const unsigned long WRITE_BLOCK_SIZE = 1024;
+
+// Records of the first binary format, which counted its records in the
+// header and had no checksums
+struct HistoryRecordV1 {
+    int64_t startTime;
+    int64_t endTime;
+    uint32_t moves;
+    uint8_t win;
+    uint8_t reserved[3];
+};
+
+static_assert( sizeof( HistoryRecordV1 ) == 24, "History records must not have padding" );
+
+/**
+ * @brief Read how many times the history file has been replaced, which is
+ * kept in the lock file
+ * @param LOCK The held lock on the history
+ * @return The generation of the history file, which is 0 before it was
+ * ever replaced
+ */
+static uint64_t readGeneration( const FileLock& LOCK ) {
+    uint64_t generation;
+    if( !LOCK.read( &generation, sizeof( generation ) ) ) {
+        return 0;
+    }
+
+    return generation;
+}
+
+/**
+ * @brief Get the path of a file of archived games
+ * @param PREFIX The start of the path, which tells the kind of file
+ * @param ARCHIVED_COUNT The amount of games archived once the file was
+ * written
+ * @return The path of the file
+ */
+static string getArchivePath( const char* const PREFIX, const uint64_t ARCHIVED_COUNT ) {
+    return string( PREFIX ) + to_string( ARCHIVED_COUNT ) + ".dat";
+}
+
+/**
+ * @brief Replace a file with another one that was just written
+ * @param TEMP_PATH The path of the new file
+ * @param PATH The path of the file to replace
+ * @return true if the file was replaced, false otherwise
+ */
+static bool replaceFile( const char* const TEMP_PATH, const char* const PATH ) {
+#ifdef _WIN32
+    // Renaming does not replace existing files on Windows
+    remove( PATH );
+#endif
+
+    return rename( TEMP_PATH, PATH ) == 0;
+}
+
+/**
+ * @brief Read a statistics file, which is a snapshot followed by the days
+ * of a history index and then the checksum of those days
+ * @param PATH The path of the file
+ * @param snapshot The destination snapshot
+ * @param days The destination days
+ * @return true if the whole file was read and is valid, false otherwise
+ */
+static bool readSnapshot( const char* const PATH, StatisticsSnapshot& snapshot, vector<DayRollup>& days ) {
+    ifstream statisticsIn( PATH, ios::binary );
+    statisticsIn.read( reinterpret_cast<char*>( &snapshot ), sizeof( snapshot ) );
+    if( statisticsIn.fail() || !snapshot.isValid() ) {
+        return false;
+    }
+
+    uint32_t checksum;
+    days.resize( snapshot.dayCount );
+    statisticsIn.read( reinterpret_cast<char*>( days.data() ), days.size() * sizeof( DayRollup ) );
+    statisticsIn.read( reinterpret_cast<char*>( &checksum ), sizeof( checksum ) );
+    return !statisticsIn.fail() 
+        && checksum == computeChecksum( days.data(), days.size() * sizeof( DayRollup ) );
+}
+
+/**
+ * @brief Write a statistics file, replacing the current one once it is
+ * complete. It is only a cache of the history, so it is never synced
+ * @param PATH The path of the file
+ * @param TEMP_PATH The path to write the file to before replacing it
+ * @param SNAPSHOT The snapshot of the statistics
+ * @param DAYS The days of the history index
+ * @return true if the file was written, false otherwise
+ */
+static bool writeSnapshot( 
+    const char* const PATH, 
+    const char* const TEMP_PATH, 
+    const StatisticsSnapshot& SNAPSHOT, 
+    const vector<DayRollup>& DAYS 
+) {
+    AppendOnlyFile statisticsOut;
+    if( !statisticsOut.open( TEMP_PATH, SyncPolicy::NEVER ) || !statisticsOut.truncate( 0 ) ) {
+        return false;
+    }
+
+    const uint32_t DAYS_CHECKSUM = computeChecksum( DAYS.data(), DAYS.size() * sizeof( DayRollup ) );
+    const bool WRITTEN = statisticsOut.append( &SNAPSHOT, sizeof( SNAPSHOT ) )
+        && statisticsOut.append( DAYS.data(), DAYS.size() * sizeof( DayRollup ) )
+        && statisticsOut.append( &DAYS_CHECKSUM, sizeof( DAYS_CHECKSUM ) );
+    statisticsOut.close();
+
+    return WRITTEN && replaceFile( TEMP_PATH, PATH );
+}
+
+/**
+ * @brief Skip past spaces in the text format
+ * @param pCursor The first character to check
+ * @param pEnd The end of the text
+ * @return The first character that is not a space, or pEnd
+ */
+static const char* skipSpaces( const char* pCursor, const char* const pEnd ) {
+    while( pCursor < pEnd && (*pCursor == ' ' || *pCursor == '\t' || *pCursor == '\r' || *pCursor == '\n') ) {
+        ++pCursor;
+    }
+
+    return pCursor;
+}
+
+/**
+ * @brief Read an unsigned number from the text format
+ * @param pCursor The first character of the number, which is moved past
+ * the number if it is read
+ * @param pEnd The end of the text
+ * @param value The destination value
+ * @return true if there was a number of at most 19 digits, false otherwise
+ */
+static bool parseUnsigned( const char*& pCursor, const char* const pEnd, uint64_t& value ) {
+    // Any 19 digit number fits in 64 bits, so only the amount of digits
+    // has to be checked rather than every step
+    const char* pDigit = pCursor;
+    value = 0;
+    while( pDigit < pEnd && *pDigit >= '0' && *pDigit <= '9' ) {
+        value = value * 10 + (*pDigit - '0');
+        ++pDigit;
+    }
+
+    if( pDigit == pCursor || pDigit - pCursor > 19 ) {
+        return false;
+    }
+
+    pCursor = pDigit;
+    return true;
+}
+
+/**
+ * @brief Read a number that may be negative from the text format
+ * @param pCursor The first character of the number, which is moved past
+ * the number if it is read
+ * @param pEnd The end of the text
+ * @param value The destination value
+ * @return true if there was a number of at most 19 digits that fits in 64
+ * bits, false otherwise
+ */
+static bool parseSigned( const char*& pCursor, const char* const pEnd, int64_t& value ) {
+    const char* pDigits = pCursor;
+    const bool IS_NEGATIVE = pDigits < pEnd && *pDigits == '-';
+    if( IS_NEGATIVE ) {
+        ++pDigits;
+    }
+
+    uint64_t magnitude;
+    if( !parseUnsigned( pDigits, pEnd, magnitude ) || magnitude > (uint64_t) INT64_MAX ) {
+        return false;
+    }
+
+    value = IS_NEGATIVE ? -(int64_t) magnitude : (int64_t) magnitude;
+    pCursor = pDigits;
+    return true;
+}
+
 History::History() {
-    // Nothing to do
+    mPRecords = nullptr;
+    mRecordCount = 0;
+    mSyncPolicy = SyncPolicy::EVERY_APPEND;
+    mFileSize = 0;
+    mNeedsRewrite = false;
+    mUnsavedCount = 0;
+    mStatistics = Statistics();
+    mGeneration = 0;
+    mArchivedCount = 0;
+    mCompactionHorizon = DEFAULT_COMPACTION_HORIZON;
+}
+
+bool History::lockFiles( FileLock& lock ) {
+    return lock.lock( LOCK_PATH );
+}
+
+vector<string> History::getFilePaths() {
+    // Each file names the amount of games archived before it, which is
+    // also the name of the segment that comes before it
+    vector<string> paths;
+    string path = HISTORY_PATH;
+    uint64_t archivedCount = UINT64_MAX;
+    while( true ) {
+        ifstream historyIn( path, ios::binary );
+        if( historyIn.fail() ) {
+            break;
+        }
+        paths.push_back( path );
+
+        // Every segment comes before fewer games than the one after it,
+        // which keeps a damaged file from sending this around in circles
+        HistoryHeader header;
+        historyIn.read( reinterpret_cast<char*>( &header ), sizeof( header ) );
+        const bool HAS_SEGMENT = !historyIn.fail() 
+            && memcmp( header.magic, MAGIC, sizeof( MAGIC ) ) == 0
+            && header.version == VERSION 
+            && header.archivedCount > 0 
+            && header.archivedCount < archivedCount;
+        if( !HAS_SEGMENT ) {
+            break;
+        }
+
+        archivedCount = header.archivedCount;
+        path = getArchivePath( SEGMENT_PATH_PREFIX, archivedCount );
+    }
+
+    return vector<string>( paths.rbegin(), paths.rend() );
+}
+
+void History::setSyncPolicy( const SyncPolicy POLICY ) {
+    mSyncPolicy = POLICY;
+}
+
+void History::setCompactionHorizon( const unsigned int DAYS ) {
+    mCompactionHorizon = DAYS;
 }
 
 bool History::load() {
-    ifstream historyIn;
-    historyIn.open( "data/history.dat" );
-    if( historyIn.fail() ) {
+    // The lock is only held while the files are read, so that other
+    // instances are never kept waiting on this one while it is open. The
+    // history can still be read if the lock cannot be taken at all
+    FileLock lock;
+    lockFiles( lock );
+    return load( lock );
+}
+
+bool History::load( const FileLock& LOCK ) {
+    mGeneration = readGeneration( LOCK );
+    return mLoadFile();
+}
+
+bool History::mLoadFile() {
+    errno = 0;
+    if( !mFile.open( HISTORY_PATH ) ) {
+        if( errno != ENOENT ) {
+            return false;
+        }
+
+        // A missing file is just an empty history, such as on the first
+        // run, and the first game added creates it from scratch
+        mNeedsRewrite = true;
+        return true;
+    }
+
+    // The saved statistics are read first, as they also tell which records
+    // were already checked
+    StatisticsSnapshot snapshot;
+    vector<DayRollup> days;
+    const StatisticsSnapshot* pSnapshot = nullptr;
+    if( readSnapshot( STATISTICS_PATH, snapshot, days ) ) {
+        pSnapshot = &snapshot;
+    }
+
+    bool isBinary;
+    if( !mLoadBinary( isBinary, pSnapshot ) ) {
+        // A binary file that cannot be read may be from a newer version,
+        // so it is left alone rather than overwritten
+        cerr << "Unsupported history file format" << endl;
         return false;
     }
 
+    if( !isBinary ) {
+        // Anything else is the older text format, which is migrated to the
+        // binary format when the next game is added
+        mNeedsRewrite = true;
+        if( !mLoadText() ) {
+            return false;
+        }
+    }
+
+    mLoadStatistics( pSnapshot, days );
+    return true;
+}
+
+uint32_t History::mGetChecksum( const unsigned long INDEX ) const {
+    if( INDEX < mRecordCount ) {
+        return mPRecords[INDEX].checksum;
+    }
+
+    // Records are always written the same way, so the checksum of a game
+    // held in memory is known without having its record
+    return HistoryRecord::fromInfo( getGame( INDEX ) ).checksum;
+}
+
+bool History::mLoadBinary( bool& isBinary, const StatisticsSnapshot* pSnapshot ) {
+    HistoryHeader header;
+    isBinary = mFile.getSize() >= sizeof( header ) 
+        && memcmp( mFile.getData(), MAGIC, sizeof( MAGIC ) ) == 0;
+    if( !isBinary ) {
+        return true;
+    }
+
+    memcpy( &header, mFile.getData(), sizeof( header ) );
+    if( header.version == 1 && header.recordSize == sizeof( HistoryRecordV1 ) ) {
+        // The first version kept its record count where the archived
+        // count now is, and never archived anything
+        mLoadRecordsV1( header.archivedCount );
+        return true;
+    }
+
+    if( header.version != VERSION || header.recordSize != sizeof( HistoryRecord ) ) {
+        return false;
+    }
+
+    mArchivedCount = header.archivedCount;
+    mLoadRecords( pSnapshot );
+    return true;
+}
+
+void History::mLoadRecords( const StatisticsSnapshot* pSnapshot ) {
+    // Any bytes after the last whole record are a record that was still
+    // being written, and are overwritten by the next one
+    const unsigned long AVAILABLE = (mFile.getSize() - sizeof( HistoryHeader )) / sizeof( HistoryRecord );
+
+    // The header is 8 byte aligned and mappings are page aligned, so the
+    // records are suitably aligned to be read where they are
+    mPRecords = reinterpret_cast<const HistoryRecord*>( mFile.getData() + sizeof( HistoryHeader ) );
+    mRecordCount = AVAILABLE;
+
+    // The records covered by the saved statistics were all valid when the
+    // statistics were saved. If the last of them is still the same record,
+    // the file was only appended to since, so only the records after it
+    // have to be checked. Otherwise, every record is checked
+    unsigned long checkedCount = 0;
+    if( pSnapshot != nullptr 
+        && pSnapshot->recordCount > mArchivedCount 
+        && pSnapshot->recordCount - mArchivedCount <= AVAILABLE ) {
+        const HistoryRecord& LAST = mPRecords[pSnapshot->recordCount - mArchivedCount - 1];
+        if( LAST.checksum == pSnapshot->lastChecksum && LAST.isValid() ) {
+            checkedCount = pSnapshot->recordCount - mArchivedCount;
+        }
+    }
+
+    // A crash can only damage the records that were being appended, so
+    // any invalid records at the end are simply cut off
+    while( mRecordCount > checkedCount && !mPRecords[mRecordCount - 1].isValid() ) {
+        --mRecordCount;
+    }
+    mFileSize = sizeof( HistoryHeader ) + mRecordCount * sizeof( HistoryRecord );
+
+    unsigned long invalidCount = AVAILABLE - mRecordCount;
+    for( unsigned long i = checkedCount; i < mRecordCount; ++i ) {
+        if( !mPRecords[i].isValid() ) {
+            ++invalidCount;
+        }
+    }
+
+    if( invalidCount > AVAILABLE - mRecordCount ) {
+        // Invalid records before valid ones mean that the file was damaged
+        // some other way. The valid records are kept, and the file is
+        // rewritten without the others when the next game is added
+        mGames.reserve( mRecordCount );
+        for( unsigned long i = 0; i < mRecordCount; ++i ) {
+            if( i < checkedCount || mPRecords[i].isValid() ) {
+                mGames.add( mPRecords[i].toInfo() );
+            }
+        }
+
+        mPRecords = nullptr;
+        mRecordCount = 0;
+        mFileSize = 0;
+        mNeedsRewrite = true;
+    }
+
+    if( invalidCount > 0 ) {
+        cerr << "Skipped " << invalidCount << " incomplete history entries" << endl;
+    }
+}
+
+void History::mLoadRecordsV1( const uint64_t RECORD_COUNT ) {
+    // Never trust the record count beyond what the file actually holds
+    const unsigned long AVAILABLE = (mFile.getSize() - sizeof( HistoryHeader )) / sizeof( HistoryRecordV1 );
+    const unsigned long COUNT = RECORD_COUNT < AVAILABLE ? RECORD_COUNT : AVAILABLE;
+
+    mGames.reserve( COUNT );
+    for( unsigned long i = 0; i < COUNT; ++i ) {
+        HistoryRecordV1 recordV1;
+        memcpy( 
+            &recordV1, 
+            mFile.getData() + sizeof( HistoryHeader ) + i * sizeof( recordV1 ), 
+            sizeof( recordV1 ) 
+        );
+
+        SolitaireInfo info;
+        info.win = recordV1.win != 0;
+        info.moves = recordV1.moves;
+        info.startTime = recordV1.startTime;
+        info.endTime = recordV1.endTime;
+        mGames.add( info );
+    }
+
+    mNeedsRewrite = true;
+}
+
+void History::mLoadStatistics( const StatisticsSnapshot* pSnapshot, const vector<DayRollup>& DAYS ) {
+    // The saved statistics count games from the first archived game, and
+    // can only be used if they cover games that are still at the start of
+    // the history file
+    const unsigned long GAME_COUNT = getGameCount();
+    const bool IS_CURRENT = pSnapshot != nullptr
+        && pSnapshot->recordCount <= mArchivedCount + GAME_COUNT
+        && ( pSnapshot->recordCount == 0 
+            ? mArchivedCount == 0 
+            : pSnapshot->recordCount > mArchivedCount 
+                && mGetChecksum( pSnapshot->recordCount - mArchivedCount - 1 ) == pSnapshot->lastChecksum );
+
+    if( !IS_CURRENT ) {
+        // Every game in the file has to be read, which is split between
+        // threads for long histories. Archived games are only read from
+        // their statistics, as they always come first
+        StatisticsSummary summary = StatisticsSummary();
+        mIndex = HistoryIndex();
+        if( mArchivedCount > 0 ) {
+            StatisticsSnapshot snapshot;
+            vector<DayRollup> days;
+            const string ARCHIVE_PATH = getArchivePath( ARCHIVE_PATH_PREFIX, mArchivedCount );
+            if( readSnapshot( ARCHIVE_PATH.c_str(), snapshot, days ) && snapshot.recordCount == mArchivedCount ) {
+                summary = StatisticsSummary::fromStatistics( snapshot.toStatistics() );
+                mIndex.assign( days.data(), days.size() );
+            } else {
+                cerr << "Unable to read the statistics of archived games" << endl;
+            }
+        }
+
+        const unsigned int THREAD_AMOUNT = thread::hardware_concurrency();
+        summary.append( StatisticsSummary::fromRecords( mPRecords, mRecordCount, THREAD_AMOUNT ) );
+        summary.append( StatisticsSummary::fromColumns( mGames, THREAD_AMOUNT ) );
+        mStatistics = summary.toStatistics();
+
+        for( unsigned long i = 0; i < GAME_COUNT; ++i ) {
+            mIndex.add( getGame( i ) );
+        }
+        return;
+    }
+
+    // Only the newer games are read, which are usually none at all
+    mStatistics = pSnapshot->toStatistics();
+    mIndex.assign( DAYS.data(), DAYS.size() );
+    for( unsigned long i = pSnapshot->recordCount - mArchivedCount; i < GAME_COUNT; ++i ) {
+        const SolitaireInfo INFO = getGame( i );
+        mAddToStatistics( mStatistics, INFO );
+        mIndex.add( INFO );
+    }
+}
+
+bool History::mLoadText() {
+    const char* pCursor = mFile.getData();
+    const char* const pEnd = pCursor + mFile.getSize();
+
     // History data begins with a number specifying the amount of
     // game information that exists in the file
-    unsigned int length;
-    historyIn >> length;
-    if( historyIn.fail() ) {
+    uint64_t length;
+    pCursor = skipSpaces( pCursor, pEnd );
+    if( !parseUnsigned( pCursor, pEnd, length ) ) {
         // A history without a length value is just an empty history
+        mFile.close();
         return true;
     }
 
-    // The rest of the file is game information
+    // Every entry takes at least eight characters, so an absurd length
+    // does not reserve more than the file could hold
+    const uint64_t MAX_LENGTH = mFile.getSize() / 8;
+    mGames.reserve( length < MAX_LENGTH ? length : MAX_LENGTH );
+
+    // The rest of the file is game information, one entry per line. Lines
+    // are found and read in place, so an entry that cannot be read only
+    // costs finding the next newline
+    unsigned long goodCount = 0;
+    unsigned long badCount = 0;
     SolitaireInfo info;
-    for( unsigned int i = 0; i < length; ++i ) {
-        if( mLoadInfo( historyIn, info ) ) {
-            // This is valid information data
-            mInfos.push_back( info );
-        } else {
-            // This is not valid information data, skip to the next
-            // value and let the user know
-            cerr << "Unable to read history entry #" << (i + 1) << endl;
-            historyIn.clear();
-            char badChar = 0;
-            do { 
-                historyIn.get( badChar ); 
-            } while( badChar != '\n' && badChar != 0 );
+    while( goodCount + badCount < length && pCursor < pEnd ) {
+        const char* pLineEnd = static_cast<const char*>( memchr( pCursor, '\n', pEnd - pCursor ) );
+        if( pLineEnd == nullptr ) {
+            pLineEnd = pEnd;
+        }
+
+        // Blank lines are not entries
+        const bool IS_BLANK = skipSpaces( pCursor, pLineEnd ) == pLineEnd;
+        if( !IS_BLANK && mLoadInfo( pCursor, pLineEnd, info ) ) {
+            mGames.add( info );
+            ++goodCount;
+        } else if( !IS_BLANK ) {
+            ++badCount;
         }
+
+        pCursor = pLineEnd < pEnd ? pLineEnd + 1 : pEnd;
+    }
+
+    if( badCount > 0 ) {
+        // Let the user know how much of the history could not be read
+        cerr << "Read " << goodCount << " history entries, skipped " 
+            << badCount << " that could not be read" << endl;
     }
 
-    historyIn.close();
+    // Everything has been copied out of the file
+    mFile.close();
 
     return true;
 }
 
-void History::add( const SolitaireInfo INFO ) {
+bool History::add( const SolitaireInfo INFO ) {
     // Only add games where the player made a move. This prevents
     // very short, uncompleted games from polluting the history
-    if( INFO.moves > 0 ) {
-        mInfos.push_back( INFO );
+    if( INFO.moves == 0 ) {
+        return true;
     }
+
+    // Other instances may have added games since this one last looked at
+    // the file, which have to be read first so that none of them are lost
+    // when the file is written. The lock is held until the game is saved
+    FileLock lock;
+    const bool IS_CURRENT = lockFiles( lock ) && mCatchUp( lock );
+
+    mAddGame( INFO );
+    ++mUnsavedCount;
+
+    if( !IS_CURRENT ) {
+        // The game is saved along with the next one instead
+        return false;
+    }
+
+    // Files that are not in the current format have to be replaced as a
+    // whole once, after which games can be appended to them. Games that
+    // could not be saved before are appended along with this one
+    const bool SAVED = mNeedsRewrite ? mSaveAll( lock ) : mSaveUnsaved();
+    if( SAVED ) {
+        mNeedsRewrite = false;
+        mUnsavedCount = 0;
+    }
+
+    if( SAVED ) {
+        // Games older than the horizon are moved out of the file, so that it
+        // does not keep growing. Failing to do so only means trying again
+        // with the next game
+        if( mCompactionHorizon > 0 ) {
+            mCompact( lock, DayRollup::getDay( INFO.startTime ) - mCompactionHorizon );
+        }
+
+        // The statistics are only a cache of the history, so they are not
+        // synced, and failing to write them loses nothing
+        mSaveStatistics();
+    }
+
+    return SAVED;
 }
 
-Statistics History::getStatistics() const {
-    // Most statistics values can be initialized with zeroes.
-    // This is okay, as these values are nearly always overwritten
-    // by the time we are done
-    Statistics statistics {
-        totalGames: (unsigned int) mInfos.size(),
-        0
-    };
-
-    for( SolitaireInfo info : mInfos ) {
-        if( info.win ) {
-            if( statistics.wins == 0 ) {
-                // This is the first win, so it msut currently have
-                // the lowest winning time and lowest winning moves
-                statistics.shortestWinDuration = info.getDuration();
-                statistics.smallestWinMoves = info.moves;
-            } else {
-                // Otherwise, do the typical min checking
-                if( info.getDuration() < statistics.shortestWinDuration ) {
-                    statistics.shortestWinDuration = info.getDuration();
-                }
-
-                if( info.moves < statistics.smallestWinMoves ) {
-                    statistics.smallestWinMoves = info.moves;
-                }
-            }
+bool History::mCatchUp( const FileLock& LOCK ) {
+    // Games that could not be saved yet are always the last games held in
+    // memory, and are kept aside so that they can go after any games that
+    // other instances saved in the meantime
+    vector<SolitaireInfo> unsaved;
+    for( unsigned long i = mGames.getSize() - mUnsavedCount; i < mGames.getSize(); ++i ) {
+        unsaved.push_back( mGames.getInfo( i ) );
+    }
 
-            if( statistics.isOnWinningStreak ) {
-                // This win extends the current winning streak
-                ++statistics.currentStreakLength;
-            } else {
-                // This win starts a winning streak. Keep the last
-                // streak if it ends up being the longest losing streak
-                if( statistics.currentStreakLength > statistics.longestLosingStreak ) {
-                    statistics.longestLosingStreak = statistics.currentStreakLength;
-                }
-
-                statistics.isOnWinningStreak = true;
-                statistics.currentStreakLength = 1;
+    // If another instance replaced the file, which only happens when it is
+    // migrated, repaired, or compacted, everything is read again. The same
+    // goes for when there are unsaved games, as the statistics cannot take
+    // games back out
+    const uint64_t GENERATION = readGeneration( LOCK );
+    if( GENERATION != mGeneration || !unsaved.empty() ) {
+        mGeneration = GENERATION;
+        mReload();
+    }
+
+    const bool IS_CURRENT = mReadAppended();
+
+    for( const SolitaireInfo& INFO : unsaved ) {
+        mAddGame( INFO );
+    }
+    mUnsavedCount = unsaved.size();
+
+    return IS_CURRENT;
+}
+
+bool History::mReadAppended() {
+    // Only files in the current format are appended to by other instances
+    if( mFileSize == 0 ) {
+        return true;
+    }
+
+    unsigned long size;
+    if( !mJournal.isOpen() && !mJournal.open( HISTORY_PATH, mSyncPolicy ) ) {
+        return false;
+    }
+    if( !mJournal.getSize( size ) ) {
+        return false;
+    }
+
+    if( size < mFileSize ) {
+        // Records that were read are gone, which no instance ever does, so
+        // the file is replaced with every game known here
+        mNeedsRewrite = true;
+        return true;
+    }
+
+    // Read the newer records a block at a time. Anything after the last
+    // valid record is an append that never finished, which is cut off
+    HistoryRecord records[WRITE_BLOCK_SIZE];
+    unsigned long offset = mFileSize;
+    unsigned long invalidCount = 0;
+    while( size - offset >= sizeof( HistoryRecord ) ) {
+        const unsigned long REMAINING = (size - offset) / sizeof( HistoryRecord );
+        const unsigned long COUNT = REMAINING < WRITE_BLOCK_SIZE ? REMAINING : WRITE_BLOCK_SIZE;
+        if( !mJournal.read( offset, records, COUNT * sizeof( HistoryRecord ) ) ) {
+            return false;
+        }
+
+        for( unsigned long i = 0; i < COUNT; ++i ) {
+            offset += sizeof( HistoryRecord );
+            if( !records[i].isValid() ) {
+                ++invalidCount;
+                continue;
             }
 
-            ++statistics.wins;
-        } else {
-            if( !statistics.isOnWinningStreak ) {
-                // This loss extends the current losing streak
-                ++statistics.currentStreakLength;
-            } else {
-                // The loss starts a losing streak. Kepe the last streak
-                // if it ends up being the longest winning streak
-                if( statistics.currentStreakLength > statistics.longestWinningStreak ) {
-                    statistics.longestWinningStreak = statistics.currentStreakLength;
-                }
-
-                statistics.isOnWinningStreak = false;
-                statistics.currentStreakLength = 1;
+            if( invalidCount > 0 ) {
+                // The same damage as found when loading, which is handled
+                // the same way by rewriting the file
+                mNeedsRewrite = true;
             }
+
+            mAddGame( records[i].toInfo() );
+            mFileSize = offset;
         }
     }
 
+    // Appends have to start right after the last valid record
+    return size == mFileSize || mJournal.truncate( mFileSize );
+}
+
+void History::mReload() {
+    mFile.close();
+    mJournal.close();
+    mPRecords = nullptr;
+    mRecordCount = 0;
+    mGames = HistoryColumns();
+    mUnsavedCount = 0;
+    mFileSize = 0;
+    mNeedsRewrite = false;
+    mStatistics = Statistics();
+    mIndex = HistoryIndex();
+    mArchivedCount = 0;
+    mLoadFile();
+}
+
+bool History::mCompact( FileLock& lock, const int64_t FIRST_DAY ) {
+    // Only a run of old games at the start of the file can be archived, as
+    // the games have to stay in order. The newest game is never old enough,
+    // so the file always keeps at least one game
+    const unsigned long GAME_COUNT = getGameCount();
+    if( GAME_COUNT < MIN_COMPACTION_GAMES 
+        || DayRollup::getDay( getGame( MIN_COMPACTION_GAMES - 1 ).startTime ) >= FIRST_DAY ) {
+        return true;
+    }
+
+    unsigned long count = 0;
+    while( count < GAME_COUNT && DayRollup::getDay( getGame( count ).startTime ) < FIRST_DAY ) {
+        ++count;
+    }
+
+    if( count < MIN_COMPACTION_GAMES ) {
+        return true;
+    }
+
+    // The statistics of the archived games so far are added to, as the
+    // games they cover are no longer kept in the history file
+    Statistics archived = Statistics();
+    HistoryIndex archivedIndex;
+    const string PREVIOUS_ARCHIVE_PATH = getArchivePath( ARCHIVE_PATH_PREFIX, mArchivedCount );
+    if( mArchivedCount > 0 ) {
+        StatisticsSnapshot snapshot;
+        vector<DayRollup> days;
+        if( !readSnapshot( PREVIOUS_ARCHIVE_PATH.c_str(), snapshot, days ) || snapshot.recordCount != mArchivedCount ) {
+            // Archiving more games would make the statistics inexact
+            return false;
+        }
+
+        archived = snapshot.toStatistics();
+        archivedIndex.assign( days.data(), days.size() );
+    }
+
+    for( unsigned long i = 0; i < count; ++i ) {
+        const SolitaireInfo INFO = getGame( i );
+        mAddToStatistics( archived, INFO );
+        archivedIndex.add( INFO );
+    }
+
+    // The raw records and the statistics of the games are written first, so
+    // that the history file never refers to archives that do not exist
+    const uint64_t ARCHIVED_COUNT = mArchivedCount + count;
+    const string SEGMENT_PATH = getArchivePath( SEGMENT_PATH_PREFIX, ARCHIVED_COUNT );
+    const string SEGMENT_TEMP_PATH = SEGMENT_PATH + ".tmp";
+    const string ARCHIVE_PATH = getArchivePath( ARCHIVE_PATH_PREFIX, ARCHIVED_COUNT );
+    const string ARCHIVE_TEMP_PATH = ARCHIVE_PATH + ".tmp";
+    const StatisticsSnapshot ARCHIVE = StatisticsSnapshot::fromStatistics( 
+        archived, 
+        ARCHIVED_COUNT, 
+        mGetChecksum( count - 1 ), 
+        archivedIndex.getDays().size() 
+    );
+
+    bool written = mWriteGames( SEGMENT_TEMP_PATH.c_str(), 0, count, mArchivedCount )
+        && replaceFile( SEGMENT_TEMP_PATH.c_str(), SEGMENT_PATH.c_str() )
+        && writeSnapshot( ARCHIVE_PATH.c_str(), ARCHIVE_TEMP_PATH.c_str(), ARCHIVE, archivedIndex.getDays() );
+
+    // Replacing the history file with the rest of the games is what
+    // actually moves the games to the archives
+    mJournal.close();
+    written = written && mWriteGames( HISTORY_TEMP_PATH, count, GAME_COUNT, ARCHIVED_COUNT );
+    const uint64_t GENERATION = mGeneration + 1;
+    written = written && lock.write( &GENERATION, sizeof( GENERATION ) );
+    if( !written || !replaceFile( HISTORY_TEMP_PATH, HISTORY_PATH ) ) {
+        remove( SEGMENT_PATH.c_str() );
+        remove( ARCHIVE_PATH.c_str() );
+        return false;
+    }
+
+    // Only the latest statistics of the archived games are needed
+    if( mArchivedCount > 0 ) {
+        remove( PREVIOUS_ARCHIVE_PATH.c_str() );
+    }
+
+    // Games keep their positions counted from the first archived game, so
+    // the saved statistics still match the new file
+    mGeneration = GENERATION;
+    mReload();
+    return true;
+}
+
+Statistics History::getStatistics() const {
+    // The statistics are kept up to date as games are added, so nothing
+    // has to be read here
+    Statistics statistics = mStatistics;
+
     // If the current streak we built up is actually the longest streak,
     // make sure we change the statistic to such
     const bool PENDING_WINNING_STREAK = statistics.isOnWinningStreak 
@@ -150,59 +823,225 @@ Statistics History::getStatistics() const {
     return statistics;
 }
 
-bool History::save() const {
-    // Open the history file
-    ofstream historyOut;
-    historyOut.open( "data/history.dat" );
-    if( historyOut.fail() ) {
+const HistoryIndex& History::getIndex() const {
+    return mIndex;
+}
+
+unsigned long History::getGameCount() const {
+    return mRecordCount + mGames.getSize();
+}
+
+SolitaireInfo History::getGame( const unsigned long INDEX ) const {
+    if( INDEX < mRecordCount ) {
+        return mPRecords[INDEX].toInfo();
+    }
+
+    return mGames.getInfo( INDEX - mRecordCount );
+}
+
+void History::mAddGame( const SolitaireInfo INFO ) {
+    mGames.add( INFO );
+    mAddToStatistics( mStatistics, INFO );
+    mIndex.add( INFO );
+}
+
+void History::mAddToStatistics( Statistics& statistics, const SolitaireInfo INFO ) {
+    ++statistics.totalGames;
+
+    if( INFO.win ) {
+        if( statistics.wins == 0 ) {
+            // This is the first win, so it msut currently have
+            // the lowest winning time and lowest winning moves
+            statistics.shortestWinDuration = INFO.getDuration();
+            statistics.smallestWinMoves = INFO.moves;
+        } else {
+            // Otherwise, do the typical min checking
+            if( INFO.getDuration() < statistics.shortestWinDuration ) {
+                statistics.shortestWinDuration = INFO.getDuration();
+            }
+
+            if( INFO.moves < statistics.smallestWinMoves ) {
+                statistics.smallestWinMoves = INFO.moves;
+            }
+        }
+
+        if( statistics.isOnWinningStreak ) {
+            // This win extends the current winning streak
+            ++statistics.currentStreakLength;
+        } else {
+            // This win starts a winning streak. Keep the last
+            // streak if it ends up being the longest losing streak
+            if( statistics.currentStreakLength > statistics.longestLosingStreak ) {
+                statistics.longestLosingStreak = statistics.currentStreakLength;
+            }
+
+            statistics.isOnWinningStreak = true;
+            statistics.currentStreakLength = 1;
+        }
+
+        statistics.winDurations.add( INFO.getDuration() );
+        statistics.winMoves.add( INFO.moves );
+        ++statistics.wins;
+    } else {
+        if( !statistics.isOnWinningStreak ) {
+            // This loss extends the current losing streak
+            ++statistics.currentStreakLength;
+        } else {
+            // The loss starts a losing streak. Kepe the last streak
+            // if it ends up being the longest winning streak
+            if( statistics.currentStreakLength > statistics.longestWinningStreak ) {
+                statistics.longestWinningStreak = statistics.currentStreakLength;
+            }
+
+            statistics.isOnWinningStreak = false;
+            statistics.currentStreakLength = 1;
+        }
+
+        statistics.lossDurations.add( INFO.getDuration() );
+        statistics.lossMoves.add( INFO.moves );
+    }
+}
+
+bool History::mSaveAll( FileLock& lock ) {
+    // Write to a separate file first, so that the current history is only
+    // replaced once the new one is complete
+    mJournal.close();
+    if( !mWriteGames( HISTORY_TEMP_PATH, 0, getGameCount(), mArchivedCount ) ) {
         return false;
     }
 
-    // Only write to the file if we actually have information
-    if( mInfos.size() > 0 ) {
-        // Write the amount first
-        historyOut << mInfos.size() << endl;
+    // Other instances have to know that the file is replaced before it is,
+    // as the records they have read may no longer be where they were
+    const uint64_t GENERATION = mGeneration + 1;
+    if( !lock.write( &GENERATION, sizeof( GENERATION ) ) ) {
+        return false;
+    }
+    mGeneration = GENERATION;
+
+    if( !replaceFile( HISTORY_TEMP_PATH, HISTORY_PATH ) ) {
+        return false;
+    }
+
+    mFileSize = sizeof( HistoryHeader ) + getGameCount() * sizeof( HistoryRecord );
+    return true;
+}
+
+bool History::mWriteGames( 
+    const char* const PATH, 
+    const unsigned long BEGIN, 
+    const unsigned long END, 
+    const uint64_t ARCHIVED_COUNT 
+) const {
+    AppendOnlyFile historyOut;
+    if( !historyOut.open( PATH, SyncPolicy::NEVER ) || !historyOut.truncate( 0 ) ) {
+        return false;
+    }
+
+    HistoryHeader header;
+    memcpy( header.magic, MAGIC, sizeof( MAGIC ) );
+    header.version = VERSION;
+    header.recordSize = sizeof( HistoryRecord );
+    header.reserved = 0;
+    header.archivedCount = ARCHIVED_COUNT;
+
+    // Mapped records are written as they are
+    const unsigned long MAPPED_END = END < mRecordCount ? END : mRecordCount;
+    bool written = historyOut.append( &header, sizeof( header ) )
+        && ( BEGIN >= MAPPED_END 
+            || historyOut.append( mPRecords + BEGIN, (MAPPED_END - BEGIN) * sizeof( HistoryRecord ) ) );
 
-        // And then write all of the history entries in the same
-        // order as how they are read
-        for( SolitaireInfo info : mInfos ) {
-            historyOut << info.win << ' ' 
-                << info.moves << ' '
-                << info.startTime << ' '
-                << info.endTime << endl;
+    // Games held in memory are turned back into records a block at a time
+    HistoryRecord records[WRITE_BLOCK_SIZE];
+    for( unsigned long i = BEGIN > MAPPED_END ? BEGIN : MAPPED_END; written && i < END; i += WRITE_BLOCK_SIZE ) {
+        const unsigned long REMAINING = END - i;
+        const unsigned long COUNT = REMAINING < WRITE_BLOCK_SIZE ? REMAINING : WRITE_BLOCK_SIZE;
+        for( unsigned long j = 0; j < COUNT; ++j ) {
+            records[j] = HistoryRecord::fromInfo( getGame( i + j ) );
         }
+
+        written = historyOut.append( records, COUNT * sizeof( HistoryRecord ) );
     }
 
+    written = written && ( mSyncPolicy == SyncPolicy::NEVER || historyOut.sync() );
     historyOut.close();
+    return written;
+}
+
+bool History::mSaveStatistics() const {
+    // Only called after a game is added, so there is always a last record
+    const StatisticsSnapshot SNAPSHOT = StatisticsSnapshot::fromStatistics( 
+        mStatistics, 
+        mArchivedCount + getGameCount(), 
+        mGetChecksum( getGameCount() - 1 ),
+        mIndex.getDays().size() 
+    );
+
+    return writeSnapshot( STATISTICS_PATH, STATISTICS_TEMP_PATH, SNAPSHOT, mIndex.getDays() );
+}
+
+bool History::mSaveUnsaved() {
+    // Anything left behind by a crash or a failed append was already cut
+    // off when catching up with the file
+    if( !mJournal.isOpen() && !mJournal.open( HISTORY_PATH, mSyncPolicy ) ) {
+        return false;
+    }
+
+    // Nearly always a single game, which is then a single append
+    HistoryRecord records[WRITE_BLOCK_SIZE];
+    for( unsigned long i = mGames.getSize() - mUnsavedCount; i < mGames.getSize(); i += WRITE_BLOCK_SIZE ) {
+        const unsigned long REMAINING = mGames.getSize() - i;
+        const unsigned long COUNT = REMAINING < WRITE_BLOCK_SIZE ? REMAINING : WRITE_BLOCK_SIZE;
+        for( unsigned long j = 0; j < COUNT; ++j ) {
+            records[j] = HistoryRecord::fromInfo( mGames.getInfo( i + j ) );
+        }
+
+        if( !mJournal.append( records, COUNT * sizeof( HistoryRecord ) ) ) {
+            mJournal.close();
+            return false;
+        }
+
+        mFileSize += COUNT * sizeof( HistoryRecord );
+    }
 
     return true;
 }
 
-bool History::mLoadInfo( ifstream& stream, SolitaireInfo& info ) const {
+bool History::mLoadInfo( const char* pLine, const char* pLineEnd, SolitaireInfo& info ) const {
     // History entries consist of a line containing four entries
     // representing the win/loss state, the moves, the start time,
     // and the end time, in that order
-    stream >> info.win;
-    if( stream.fail() ) {
+    uint64_t win;
+    pLine = skipSpaces( pLine, pLineEnd );
+    if( !parseUnsigned( pLine, pLineEnd, win ) || win > 1 ) {
         return false;
     }
+    info.win = win == 1;
 
     // The move count should always be non-zero
-    stream >> info.moves;
-    if( stream.fail() || info.moves < 1 ) {
+    uint64_t moves;
+    pLine = skipSpaces( pLine, pLineEnd );
+    if( !parseUnsigned( pLine, pLineEnd, moves ) || moves < 1 || moves > UINT32_MAX ) {
         return false;
     }
+    info.moves = moves;
 
-    stream >> info.startTime;
-    if( stream.fail() ) {
+    int64_t time;
+    pLine = skipSpaces( pLine, pLineEnd );
+    if( !parseSigned( pLine, pLineEnd, time ) ) {
         return false;
     }
+    info.startTime = time;
 
     // The game duration should be non-zero
-    stream >> info.endTime;
-    if( stream.fail() || info.getDuration() < 0 ) {
+    pLine = skipSpaces( pLine, pLineEnd );
+    if( !parseSigned( pLine, pLineEnd, time ) ) {
+        return false;
+    }
+    info.endTime = time;
+    if( info.getDuration() < 0 ) {
         return false;
     }
 
-    return true;
+    // Anything else on the line means it is not an entry
+    return skipSpaces( pLine, pLineEnd ) == pLineEnd;
 }
@@ -22,63 +22,313 @@
 #ifndef HISTORY_H
 #define HISTORY_H
 
-#include <fstream>
-#include <list>
+#include <string>
+#include <vector>
 
-#include <cmath>
+#include <cstdint>
 
+#include "AppendOnlyFile.h"
+#include "FileLock.h"
+#include "HistoryColumns.h"
+#include "HistoryIndex.h"
+#include "HistoryRecord.h"
+#include "MappedFile.h"
 #include "SolitaireInfo.h"
 #include "Statistics.h"
+#include "StatisticsSnapshot.h"
+#include "SyncPolicy.h"
 
 /**
- * @brief A log of past solitaire games
+ * @brief A log of past solitaire games. The history file is a HistoryHeader
+ * followed by a HistoryRecord for every game, which is memory mapped and
+ * read in place, and each game is appended to it as soon as it is added, so
+ * that neither loading nor adding has to go through every game. Games that
+ * are not read in place, such as those from an older format or those added
+ * since loading, are held in memory in HistoryColumns. Records cut short by
+ * a crash fail their checksum and are dropped when loading, and files in an
+ * older format are rewritten once the next game is added.
+ *
+ * The statistics and the index of the games of each day are kept up to date
+ * as games are added, and are saved next to the history along with how many
+ * games they cover, so that loading only has to read the newer games.
+ * Several instances can share the same history, as each takes a lock on it
+ * while changing it, and first reads any games that the others added since.
+ * Games older than the compaction horizon are moved out of the file into
+ * archives once there are enough of them, which keep their records along
+ * with the statistics of every archived game, so that the file stays small
+ * while the statistics still cover every game
  */
 class History final {
 public:
+    /**
+     * @brief The version of the history file format that is written
+     */
+    static const uint32_t VERSION = 2;
+
     /**
      * @brief Create an uninitialized history instance
      */
     History();
 
+    /**
+     * @brief Take the lock that every instance holds while changing the
+     * history files, waiting for any other instance to finish first. No
+     * games are added, rewritten or archived while it is held
+     * @param lock The lock to take
+     * @return true if the lock is now held, false otherwise
+     */
+    static bool lockFiles( FileLock& lock );
+
+    /**
+     * @brief Get the paths of the archived segments of the history followed
+     * by the history file itself, which together hold every game in order.
+     * Archiving moves games between the files, so the lock from lockFiles
+     * has to be held from resolving the paths until the files are read
+     * @return The paths of the files that exist, oldest first
+     */
+    static std::vector<std::string> getFilePaths();
+
+    /**
+     * @brief Set when added games are forced out to disk. Every game is
+     * synced as it is added by default
+     * @param POLICY The new sync policy
+     */
+    void setSyncPolicy( const SyncPolicy POLICY );
+
+    /**
+     * @brief Set how old games have to be before they are archived, which
+     * is a year by default
+     * @param DAYS The amount of days before the day of the newest game
+     * that games are kept in the history file, or 0 to never archive games
+     */
+    void setCompactionHorizon( const unsigned int DAYS );
+
     /**
      * @brief Load the history from the expected "history.dat"
-     * file. Invalid entries are ignored
-     * @return true if the file was loaded successfully, false
-     * otherwise
+     * file. Invalid entries are ignored. Games added by other instances
+     * after this are read when the next game is added
+     * @return true if the file was loaded successfully or does not exist
+     * yet, false if it could not be read
      */
     bool load();
 
     /**
-     * @brief Add new game information to the history
+     * @brief Load the history while already holding the lock from
+     * lockFiles, such as to read it along with its archived segments
+     * @param LOCK The lock that is held
+     * @return true if the file was loaded successfully or does not exist
+     * yet, false if it could not be read
+     */
+    bool load( const FileLock& LOCK );
+
+    /**
+     * @brief Add new game information to the history, and write it to
+     * the end of the "history.dat" file
      * @param INFO The information to add
+     * @return true if the game was saved, or did not need to be, false
+     * otherwise
      */
-    void add( const SolitaireInfo INFO );
+    bool add( const SolitaireInfo INFO );
 
     /**
-     * @brief Calculate statistics based on the history
+     * @brief Get the statistics of every game in the history
      * @return A set of calculated statistics
      */
     Statistics getStatistics() const;
 
     /**
-     * @brief Save the history to the expected "history.dat"
-     * file
-     * @return true if the file was saved successfully, false
-     * otherwise
+     * @brief Get the index of the games of each day, from which the
+     * statistics of a range of days can be found
+     * @return The index of every game in the history
+     */
+    const HistoryIndex& getIndex() const;
+
+    /**
+     * @brief Get the amount of games in the history file, which are the
+     * mapped records followed by the games held in memory. Archived games
+     * are not included
+     * @return The amount of games
      */
-    bool save() const;
+    unsigned long getGameCount() const;
+
+    /**
+     * @brief Get a game from the history file
+     * @param INDEX The position of the game in the history file, which must
+     * be less than the game count
+     * @return The information of the game
+     */
+    SolitaireInfo getGame( const unsigned long INDEX ) const;
 
 private:
-    std::list<SolitaireInfo> mInfos;
+    MappedFile mFile;
+    const HistoryRecord* mPRecords;
+    unsigned long mRecordCount;
+    HistoryColumns mGames;
+    unsigned long mUnsavedCount;
+    AppendOnlyFile mJournal;
+    SyncPolicy mSyncPolicy;
+    unsigned long mFileSize;
+    bool mNeedsRewrite;
+    Statistics mStatistics;
+    HistoryIndex mIndex;
+    uint64_t mGeneration;
+    uint64_t mArchivedCount;
+    unsigned int mCompactionHorizon;
+
+    /**
+     * @brief Get the checksum of the record of a game in the history file
+     * @param INDEX The position of the game in the history
+     * @return The checksum of the record of the game
+     */
+    uint32_t mGetChecksum( const unsigned long INDEX ) const;
+
+    /**
+     * @brief Read the history file, along with its saved statistics
+     * @return true if the file was loaded successfully, false otherwise
+     */
+    bool mLoadFile();
+
+    /**
+     * @brief Read the games that other instances added to the history file
+     * since it was last read, or the whole file again if it was replaced.
+     * Games that were not saved yet are kept, and go after every game in
+     * the file
+     * @param LOCK The held lock on the history
+     * @return true if the history is up to date with the file, false
+     * otherwise
+     */
+    bool mCatchUp( const FileLock& LOCK );
+
+    /**
+     * @brief Read the records appended to the history file since it was
+     * last read, and cut off any append that never finished
+     * @return true if the history is up to date with the file, false
+     * otherwise
+     */
+    bool mReadAppended();
 
     /**
-     * @brief Attempt to read a solitaire info entry from the log
-     * @param logIn The input  stream to the history file
+     * @brief Forget everything that was read and read the history file
+     * again, such as after it was replaced
+     */
+    void mReload();
+
+    /**
+     * @brief Move the games at the start of the history file that are older
+     * than a given day into archives, if there are enough of them
+     * @param lock The held lock on the history, which records that the
+     * file was replaced
+     * @param FIRST_DAY The first day whose games are kept in the file
+     * @return true if the games were archived or did not need to be, false
+     * otherwise
+     */
+    bool mCompact( FileLock& lock, const int64_t FIRST_DAY );
+
+    /**
+     * @brief Attempt to read the mapped file as a binary history file
+     * @param isBinary Set to whether the file is in the binary format
+     * @param pSnapshot The saved statistics, or nullptr if there are none
+     * @return true if the file is valid or is not a binary file, false if
+     * it is a binary file that cannot be read
+     */
+    bool mLoadBinary( bool& isBinary, const StatisticsSnapshot* pSnapshot );
+
+    /**
+     * @brief Read the records of a history file in the current format,
+     * leaving out any that were not completely written. Records that the
+     * saved statistics cover were already checked when the statistics were
+     * saved, so only the newer records are checked if the file still ends
+     * the covered records the same way
+     * @param pSnapshot The saved statistics, or nullptr if there are none
+     */
+    void mLoadRecords( const StatisticsSnapshot* pSnapshot );
+
+    /**
+     * @brief Read the records of a history file in the first binary
+     * format, which has records without checksums
+     * @param RECORD_COUNT The amount of records the header claims to have
+     */
+    void mLoadRecordsV1( const uint64_t RECORD_COUNT );
+
+    /**
+     * @brief Use the saved statistics and index, and add the games that
+     * are newer than them. They are calculated from every game instead if
+     * they cannot be used
+     * @param pSnapshot The saved statistics, or nullptr if there are none
+     * @param DAYS The saved days of the index
+     */
+    void mLoadStatistics( const StatisticsSnapshot* pSnapshot, const std::vector<DayRollup>& DAYS );
+
+    /**
+     * @brief Read the mapped file in the older text format
+     * @return true if it was successfully read, false otherwise
+     */
+    bool mLoadText();
+
+    /**
+     * @brief Attempt to read a solitaire info entry from a line of the
+     * text format
+     * @param pLine The start of the line
+     * @param pLineEnd The end of the line, excluding the newline
      * @param info The destination information data
      * @return true if it was successfully read, false otherwise
      */
-    bool mLoadInfo( std::ifstream& historyIn, SolitaireInfo& info ) const;
+    bool mLoadInfo( const char* pLine, const char* pLineEnd, SolitaireInfo& info ) const;
+
+    /**
+     * @brief Add a game to the games held in memory, the statistics, and
+     * the index
+     * @param INFO The game to add, which must be newer than every game
+     * already in the history
+     */
+    void mAddGame( const SolitaireInfo INFO );
+
+    /**
+     * @brief Add a game to a set of statistics
+     * @param statistics The statistics to update
+     * @param INFO The game to add, which must be newer than every game
+     * already in the statistics
+     */
+    static void mAddToStatistics( Statistics& statistics, const SolitaireInfo INFO );
+
+    /**
+     * @brief Write every game to a new history file, replacing the
+     * current file
+     * @param lock The held lock on the history, which records that the
+     * file was replaced
+     * @return true if the file was written, false otherwise
+     */
+    bool mSaveAll( FileLock& lock );
+
+    /**
+     * @brief Write a range of games to a new history file
+     * @param PATH The path of the file
+     * @param BEGIN The position of the first game to write
+     * @param END The position after the last game to write
+     * @param ARCHIVED_COUNT The amount of archived games before the first
+     * game that is written
+     * @return true if the file was written, false otherwise
+     */
+    bool mWriteGames( 
+        const char* const PATH, 
+        const unsigned long BEGIN, 
+        const unsigned long END, 
+        const uint64_t ARCHIVED_COUNT 
+    ) const;
+
+    /**
+     * @brief Save the statistics and index of every game in the history file
+     * @return true if the file was written, false otherwise
+     */
+    bool mSaveStatistics() const;
+
+    /**
+     * @brief Append the games that were not saved yet to the end of the
+     * current history file
+     * @return true if the records were written, false otherwise
+     */
+    bool mSaveUnsaved();
 };
 
 
-#endif
\ No newline at end of file
+#endif
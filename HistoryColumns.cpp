@@ -0,0 +1,79 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the History Columns data structure, which holds the games
+ * of the history in memory.
+ */
+
+#include "HistoryColumns.h"
+
+using namespace std;
+
+HistoryColumns::HistoryColumns() {
+}
+
+void HistoryColumns::reserve( const unsigned long COUNT ) {
+    mWins.reserve( (COUNT + WINS_PER_WORD - 1) / WINS_PER_WORD );
+    mMoves.reserve( COUNT );
+    mStartTimes.reserve( COUNT );
+    mEndTimes.reserve( COUNT );
+}
+
+void HistoryColumns::add( const SolitaireInfo INFO ) {
+    const unsigned int OFFSET = mMoves.size() % WINS_PER_WORD;
+    if( OFFSET == 0 ) {
+        mWins.push_back( 0 );
+    }
+
+    if( INFO.win ) {
+        mWins.back() |= (uint64_t) 1 << OFFSET;
+    }
+
+    mMoves.push_back( INFO.moves );
+    mStartTimes.push_back( INFO.startTime );
+    mEndTimes.push_back( INFO.endTime );
+}
+
+unsigned long HistoryColumns::getSize() const {
+    return mMoves.size();
+}
+
+SolitaireInfo HistoryColumns::getInfo( const unsigned long INDEX ) const {
+    SolitaireInfo info;
+    info.win = (mWins[INDEX / WINS_PER_WORD] >> (INDEX % WINS_PER_WORD)) & 1;
+    info.moves = mMoves[INDEX];
+    info.startTime = mStartTimes[INDEX];
+    info.endTime = mEndTimes[INDEX];
+    return info;
+}
+
+const uint64_t* HistoryColumns::getWins() const {
+    return mWins.data();
+}
+
+const uint32_t* HistoryColumns::getMoves() const {
+    return mMoves.data();
+}
+
+const int64_t* HistoryColumns::getStartTimes() const {
+    return mStartTimes.data();
+}
+
+const int64_t* HistoryColumns::getEndTimes() const {
+    return mEndTimes.data();
+}
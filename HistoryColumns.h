@@ -0,0 +1,110 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the History Columns data structure, which holds the games of the
+ * history in memory.
+ */
+
+#ifndef HISTORY_COLUMNS_H
+#define HISTORY_COLUMNS_H
+
+#include <vector>
+
+#include <cstdint>
+
+#include "SolitaireInfo.h"
+
+/**
+ * @brief A list of games held in memory, with each field of the games kept
+ * in a contiguous column of its own rather than each game being kept
+ * together. Wins take a single bit, so a game takes about 20 bytes, and
+ * going through one field of every game reads nothing else
+ */
+class HistoryColumns final {
+public:
+    /**
+     * @brief The amount of wins held in a word of the win column
+     */
+    static const unsigned int WINS_PER_WORD = 64;
+
+    /**
+     * @brief Create an empty list of games
+     */
+    HistoryColumns();
+
+    /**
+     * @brief Make room for a given amount of games
+     * @param COUNT The amount of games to make room for
+     */
+    void reserve( const unsigned long COUNT );
+
+    /**
+     * @brief Add a game to the end of the list
+     * @param INFO The game to add
+     */
+    void add( const SolitaireInfo INFO );
+
+    /**
+     * @brief Get the amount of games in the list
+     * @return The amount of games
+     */
+    unsigned long getSize() const;
+
+    /**
+     * @brief Get a game from the list
+     * @param INDEX The position of the game, which must be in the list
+     * @return The information of the game
+     */
+    SolitaireInfo getInfo( const unsigned long INDEX ) const;
+
+    /**
+     * @brief Get the win column, where bit i of word w is set if game
+     * w * WINS_PER_WORD + i is a win. Bits past the end of the list are
+     * never set
+     * @return The first word of the column
+     */
+    const uint64_t* getWins() const;
+
+    /**
+     * @brief Get the moves column, which holds the moves of every game
+     * @return The moves of the first game
+     */
+    const uint32_t* getMoves() const;
+
+    /**
+     * @brief Get the start time column, which holds the time every game
+     * was started at
+     * @return The start time of the first game
+     */
+    const int64_t* getStartTimes() const;
+
+    /**
+     * @brief Get the end time column, which holds the time every game was
+     * ended at
+     * @return The end time of the first game
+     */
+    const int64_t* getEndTimes() const;
+
+private:
+    std::vector<uint64_t> mWins;
+    std::vector<uint32_t> mMoves;
+    std::vector<int64_t> mStartTimes;
+    std::vector<int64_t> mEndTimes;
+};
+
+#endif
@@ -0,0 +1,284 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the history exporter, which streams the games of history
+ * files out as text for other programs to read.
+ */
+
+#include "HistoryExporter.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include <cstring>
+
+#include "FileLock.h"
+#include "HistoryHeader.h"
+#include "HistoryRecord.h"
+
+// Records are read this many at a time
+static const unsigned long READ_BLOCK_SIZE = 1024;
+
+// No line is ever longer than this, so the buffer is written out whenever
+// it has less room left
+static const unsigned long MAX_LINE_SIZE = 256;
+
+// Every two digit number, which lets numbers be written two digits at a time
+static const char DIGIT_PAIRS[] = 
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+HistoryExporter::HistoryExporter( ostream& out, const ExportFormat FORMAT ) {
+    mPOut = &out;
+    mFormat = FORMAT;
+    mWithDuration = false;
+    mWithStreak = false;
+    mIsStarted = false;
+    mIsLastWin = false;
+    mStreakLength = 0;
+    mExportedCount = 0;
+    mSkippedCount = 0;
+    mBufferSize = 0;
+}
+
+void HistoryExporter::setColumns( const bool WITH_DURATION, const bool WITH_STREAK ) {
+    if( mIsStarted ) {
+        return;
+    }
+
+    mWithDuration = WITH_DURATION;
+    mWithStreak = WITH_STREAK;
+}
+
+bool HistoryExporter::exportHistory() {
+    // Archiving moves games from the history file into a new segment, so
+    // the lock is held until every file has been read. Otherwise, games
+    // archived in between would be in neither the segments that were
+    // found nor what is left of the history file. As when loading, the
+    // history can still be read if the lock cannot be taken at all
+    FileLock lock;
+    History::lockFiles( lock );
+
+    // The history file is the last path, if it exists, and is read through
+    // the history, which also reads the older formats
+    const vector<string> PATHS = History::getFilePaths();
+    for( unsigned long i = 0; i + 1 < PATHS.size(); ++i ) {
+        if( !exportFile( PATHS[i].c_str() ) ) {
+            return false;
+        }
+    }
+
+    History history;
+    if( !history.load( lock ) ) {
+        return false;
+    }
+
+    exportGames( history );
+    return true;
+}
+
+bool HistoryExporter::exportFile( const char* PATH ) {
+    mStart();
+
+    ifstream historyIn( PATH, ios::binary );
+    if( historyIn.fail() ) {
+        return false;
+    }
+
+    HistoryHeader header;
+    historyIn.read( reinterpret_cast<char*>( &header ), sizeof( header ) );
+    if( historyIn.gcount() == 0 && historyIn.eof() ) {
+        // An empty file is a history without any games
+        return true;
+    }
+
+    const bool IS_CURRENT = !historyIn.fail() 
+        && memcmp( header.magic, "SLHS", sizeof( header.magic ) ) == 0
+        && header.version == History::VERSION 
+        && header.recordSize == sizeof( HistoryRecord );
+    if( !IS_CURRENT ) {
+        return false;
+    }
+
+    HistoryRecord records[READ_BLOCK_SIZE];
+    while( historyIn.good() ) {
+        historyIn.read( reinterpret_cast<char*>( records ), sizeof( records ) );
+        const unsigned long COUNT = historyIn.gcount() / sizeof( HistoryRecord );
+        for( unsigned long i = 0; i < COUNT; ++i ) {
+            if( records[i].isValid() ) {
+                mWriteGame( records[i].toInfo() );
+            } else {
+                ++mSkippedCount;
+            }
+        }
+
+        if( historyIn.gcount() % sizeof( HistoryRecord ) != 0 ) {
+            // A record that was still being written when the file ended
+            ++mSkippedCount;
+        }
+    }
+
+    return historyIn.eof() && !historyIn.bad();
+}
+
+void HistoryExporter::exportGames( const History& HISTORY ) {
+    mStart();
+
+    const unsigned long COUNT = HISTORY.getGameCount();
+    for( unsigned long i = 0; i < COUNT; ++i ) {
+        mWriteGame( HISTORY.getGame( i ) );
+    }
+}
+
+bool HistoryExporter::finish() {
+    mStart();
+    mFlush();
+    mPOut->flush();
+    return !mPOut->fail();
+}
+
+uint64_t HistoryExporter::getExportedCount() const {
+    return mExportedCount;
+}
+
+uint64_t HistoryExporter::getSkippedCount() const {
+    return mSkippedCount;
+}
+
+void HistoryExporter::mStart() {
+    if( mIsStarted ) {
+        return;
+    }
+
+    mIsStarted = true;
+    if( mFormat != ExportFormat::CSV ) {
+        return;
+    }
+
+    // The stored columns come in the same order as the older text format
+    mAppend( "win,moves,startTime,endTime" );
+    if( mWithDuration ) {
+        mAppend( ",duration" );
+    }
+    if( mWithStreak ) {
+        mAppend( ",streak" );
+    }
+    mAppend( "\n" );
+}
+
+void HistoryExporter::mWriteGame( const SolitaireInfo INFO ) {
+    if( mExportedCount > 0 && INFO.win == mIsLastWin ) {
+        ++mStreakLength;
+    } else {
+        mIsLastWin = INFO.win;
+        mStreakLength = 1;
+    }
+    ++mExportedCount;
+
+    if( BUFFER_SIZE - mBufferSize < MAX_LINE_SIZE ) {
+        mFlush();
+    }
+
+    // Numbers are formatted by hand rather than through the stream, which
+    // would cost far more than reading the records does
+    if( mFormat == ExportFormat::CSV ) {
+        mAppend( INFO.win ? "1," : "0," );
+        mAppendNumber( INFO.moves );
+        mAppend( "," );
+        mAppendNumber( INFO.startTime );
+        mAppend( "," );
+        mAppendNumber( INFO.endTime );
+        if( mWithDuration ) {
+            mAppend( "," );
+            mAppendNumber( INFO.getDuration() );
+        }
+        if( mWithStreak ) {
+            mAppend( "," );
+            mAppendNumber( mStreakLength );
+        }
+        mAppend( "\n" );
+        return;
+    }
+
+    mAppend( INFO.win ? "{\"win\":true,\"moves\":" : "{\"win\":false,\"moves\":" );
+    mAppendNumber( INFO.moves );
+    mAppend( ",\"startTime\":" );
+    mAppendNumber( INFO.startTime );
+    mAppend( ",\"endTime\":" );
+    mAppendNumber( INFO.endTime );
+    if( mWithDuration ) {
+        mAppend( ",\"duration\":" );
+        mAppendNumber( INFO.getDuration() );
+    }
+    if( mWithStreak ) {
+        mAppend( ",\"streak\":" );
+        mAppendNumber( mStreakLength );
+    }
+    mAppend( "}\n" );
+}
+
+void HistoryExporter::mAppend( const char* TEXT ) {
+    const unsigned long LENGTH = strlen( TEXT );
+    memcpy( mBuffer + mBufferSize, TEXT, LENGTH );
+    mBufferSize += LENGTH;
+}
+
+void HistoryExporter::mAppendNumber( const int64_t VALUE ) {
+    // The magnitude is found without negating the value, which would
+    // overflow for the smallest value
+    uint64_t magnitude = VALUE < 0 ? 0 - (uint64_t) VALUE : (uint64_t) VALUE;
+    if( VALUE < 0 ) {
+        mBuffer[mBufferSize++] = '-';
+    }
+
+    // Digits come out last first, two at a time to halve the divisions,
+    // so they are collected from the end before copying
+    char digits[20];
+    unsigned int position = sizeof( digits );
+    while( magnitude >= 100 ) {
+        const unsigned int PAIR = (magnitude % 100) * 2;
+        magnitude /= 100;
+        digits[--position] = DIGIT_PAIRS[PAIR + 1];
+        digits[--position] = DIGIT_PAIRS[PAIR];
+    }
+
+    if( magnitude >= 10 ) {
+        digits[--position] = DIGIT_PAIRS[magnitude * 2 + 1];
+        digits[--position] = DIGIT_PAIRS[magnitude * 2];
+    } else {
+        digits[--position] = '0' + magnitude;
+    }
+
+    memcpy( mBuffer + mBufferSize, digits + position, sizeof( digits ) - position );
+    mBufferSize += sizeof( digits ) - position;
+}
+
+void HistoryExporter::mFlush() {
+    mPOut->write( mBuffer, mBufferSize );
+    mBufferSize = 0;
+}
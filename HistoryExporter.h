@@ -0,0 +1,162 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the history exporter, which streams the games of history files
+ * out as text for other programs to read.
+ */
+
+#ifndef HISTORY_EXPORTER_H
+#define HISTORY_EXPORTER_H
+
+#include <ostream>
+
+#include <cstdint>
+
+#include "ExportFormat.h"
+#include "History.h"
+#include "SolitaireInfo.h"
+
+/**
+ * @brief Writes the games of history files out as text, one line per game.
+ * Records are read a block at a time and lines are written through a buffer
+ * of a fixed size, so that histories of any size can be exported without
+ * ever holding more than a block of them in memory. Games are exported in
+ * the order they are given, and the computed columns continue from one
+ * history file to the next, so the archived segments of a history can be
+ * exported one after another as if they were one file
+ */
+class HistoryExporter final {
+public:
+    /**
+     * @brief The size of the buffer that lines are written through
+     */
+    static const unsigned long BUFFER_SIZE = 65536;
+
+    /**
+     * @brief Create an exporter that writes only the stored columns
+     * @param out The stream to write the games to, which must outlive
+     * the exporter
+     * @param FORMAT How the games are written
+     */
+    HistoryExporter( std::ostream& out, const ExportFormat FORMAT );
+
+    HistoryExporter( const HistoryExporter& ) = delete;
+    HistoryExporter& operator=( const HistoryExporter& ) = delete;
+
+    /**
+     * @brief Set which computed columns are written after the stored
+     * columns of each game. Only has an effect before the first file is
+     * exported
+     * @param WITH_DURATION Whether to write the duration of each game, in
+     * seconds
+     * @param WITH_STREAK Whether to write the position of each game in the
+     * winning or losing streak it is part of, starting from 1
+     */
+    void setColumns( const bool WITH_DURATION, const bool WITH_STREAK );
+
+    /**
+     * @brief Export every game of the history, from its archived segments
+     * and then the history file itself. The history is locked throughout,
+     * so that no games are archived or added part way through. A missing
+     * or empty history file has no games, and one in an older format is
+     * read as the game would read it
+     * @return true if every file was read, false otherwise
+     */
+    bool exportHistory();
+
+    /**
+     * @brief Export every game of a history file in the current binary
+     * format. Records that were not completely written are skipped, and
+     * an empty file has no games
+     * @param PATH The path of the history file
+     * @return true if the whole file was read, false if it could not be
+     * read or is not in the current format
+     */
+    bool exportFile( const char* PATH );
+
+    /**
+     * @brief Export every game of a loaded history, which can be read
+     * from any format the history can load, including older ones
+     * @param HISTORY The history to export the games of
+     */
+    void exportGames( const History& HISTORY );
+
+    /**
+     * @brief Write out anything still in the buffer. Must be called once
+     * every file was exported, even if there were none
+     * @return true if every game was written, false otherwise
+     */
+    bool finish();
+
+    /**
+     * @brief Get the amount of games that were exported
+     * @return The amount of games
+     */
+    uint64_t getExportedCount() const;
+
+    /**
+     * @brief Get the amount of records that were skipped as they were not
+     * completely written
+     * @return The amount of records
+     */
+    uint64_t getSkippedCount() const;
+
+private:
+    std::ostream* mPOut;
+    ExportFormat mFormat;
+    bool mWithDuration;
+    bool mWithStreak;
+    bool mIsStarted;
+    bool mIsLastWin;
+    unsigned long mStreakLength;
+    uint64_t mExportedCount;
+    uint64_t mSkippedCount;
+    char mBuffer[BUFFER_SIZE];
+    unsigned long mBufferSize;
+
+    /**
+     * @brief Write the line naming the columns, if the format has one and
+     * it was not written yet
+     */
+    void mStart();
+
+    /**
+     * @brief Write the line of a game
+     * @param INFO The game to write
+     */
+    void mWriteGame( const SolitaireInfo INFO );
+
+    /**
+     * @brief Add text to the buffer, which must have room for it
+     * @param TEXT The text to add
+     */
+    void mAppend( const char* TEXT );
+
+    /**
+     * @brief Add a number to the buffer, which must have room for it
+     * @param VALUE The number to add
+     */
+    void mAppendNumber( const int64_t VALUE );
+
+    /**
+     * @brief Write the buffer to the stream and empty it
+     */
+    void mFlush();
+};
+
+#endif
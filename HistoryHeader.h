@@ -0,0 +1,67 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the History Header data structure, which identifies and describes
+ * the contents of the history file.
+ */
+
+#ifndef HISTORY_HEADER_H
+#define HISTORY_HEADER_H
+
+#include <cstdint>
+
+/**
+ * @brief The start of a history file, which is followed by the records of
+ * every game until the end of the file. Files are written in the byte order
+ * of the machine, which the version field also detects, as a file from a
+ * machine of the other byte order will never have a known version
+ */
+struct HistoryHeader {
+    /**
+     * @brief Always "SLHS", which tells binary history files apart from
+     * the older text format
+     */
+    char magic[4];
+
+    /**
+     * @brief The version of the format of the file
+     */
+    uint32_t version;
+
+    /**
+     * @brief The size of each record in bytes
+     */
+    uint32_t recordSize;
+
+    /**
+     * @brief Unused space, always written as zero
+     */
+    uint32_t reserved;
+
+    /**
+     * @brief The amount of games before the first record that were moved
+     * out of the file into archives. Version 1 stored the amount of records
+     * here, but records are now counted from the size of the file, so that
+     * appending one never rewrites the header
+     */
+    uint64_t archivedCount;
+};
+
+static_assert( sizeof( HistoryHeader ) == 24, "History headers must not have padding" );
+
+#endif
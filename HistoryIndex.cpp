@@ -0,0 +1,79 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the History Index data structure, which totals the games of
+ * the history for each day.
+ */
+
+#include "HistoryIndex.h"
+
+using namespace std;
+
+HistoryIndex::HistoryIndex() {}
+
+void HistoryIndex::assign( const DayRollup* pDays, const unsigned long COUNT ) {
+    mDays.assign( pDays, pDays + COUNT );
+}
+
+void HistoryIndex::add( const SolitaireInfo INFO ) {
+    const int64_t DAY = DayRollup::getDay( INFO.startTime );
+
+    // Games are nearly always added in order, and so go on the last day
+    // or a new day after it
+    if( mDays.empty() || mDays.back().day < DAY ) {
+        mDays.push_back( DayRollup::empty( DAY ) );
+        mDays.back().add( INFO );
+        return;
+    }
+
+    const unsigned long POSITION = mFind( DAY );
+    if( mDays[POSITION].day != DAY ) {
+        mDays.insert( mDays.begin() + POSITION, DayRollup::empty( DAY ) );
+    }
+
+    mDays[POSITION].add( INFO );
+}
+
+const vector<DayRollup>& HistoryIndex::getDays() const {
+    return mDays;
+}
+
+DayRollup HistoryIndex::getRange( const int64_t FIRST_DAY, const int64_t LAST_DAY ) const {
+    DayRollup range = DayRollup::empty( FIRST_DAY );
+    for( unsigned long i = mFind( FIRST_DAY ); i < mDays.size() && mDays[i].day <= LAST_DAY; ++i ) {
+        range.merge( mDays[i] );
+    }
+
+    return range;
+}
+
+unsigned long HistoryIndex::mFind( const int64_t DAY ) const {
+    // Binary search, as the days are in order
+    unsigned long low = 0;
+    unsigned long high = mDays.size();
+    while( low < high ) {
+        const unsigned long MIDDLE = low + (high - low) / 2;
+        if( mDays[MIDDLE].day < DAY ) {
+            low = MIDDLE + 1;
+        } else {
+            high = MIDDLE;
+        }
+    }
+
+    return low;
+}
@@ -0,0 +1,84 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the History Index data structure, which totals the games of the
+ * history for each day.
+ */
+
+#ifndef HISTORY_INDEX_H
+#define HISTORY_INDEX_H
+
+#include <vector>
+
+#include <cstdint>
+
+#include "DayRollup.h"
+#include "SolitaireInfo.h"
+
+/**
+ * @brief The games of the history totalled for each day that has any, in
+ * order of their days. Totals over any range of days can then be found from
+ * the days alone, without going through every game
+ */
+class HistoryIndex final {
+public:
+    /**
+     * @brief Create an index without any games
+     */
+    HistoryIndex();
+
+    /**
+     * @brief Replace the index with a list of days
+     * @param pDays The days, which must be in order and not repeat
+     * @param COUNT The amount of days
+     */
+    void assign( const DayRollup* pDays, const unsigned long COUNT );
+
+    /**
+     * @brief Add a game to the day it was started on
+     * @param INFO The game to add
+     */
+    void add( const SolitaireInfo INFO );
+
+    /**
+     * @brief Get every day in the index
+     * @return The days that have any games, in order
+     */
+    const std::vector<DayRollup>& getDays() const;
+
+    /**
+     * @brief Total the games of a range of days
+     * @param FIRST_DAY The first day of the range
+     * @param LAST_DAY The last day of the range, included in the totals
+     * @return The totals of every game in the range
+     */
+    DayRollup getRange( const int64_t FIRST_DAY, const int64_t LAST_DAY ) const;
+
+private:
+    std::vector<DayRollup> mDays;
+
+    /**
+     * @brief Find the first day in the index that is not before a day
+     * @param DAY The day to look for
+     * @return The position of the day in the index, or the amount of days
+     * if every day is before it
+     */
+    unsigned long mFind( const int64_t DAY ) const;
+};
+
+#endif
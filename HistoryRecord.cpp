@@ -0,0 +1,58 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the History Record data structure, which is how a single
+ * game is stored within the history file.
+ */
+
+#include "HistoryRecord.h"
+
+#include <cstddef>
+
+#include "Checksum.h"
+
+HistoryRecord HistoryRecord::fromInfo( const SolitaireInfo INFO ) {
+    HistoryRecord record;
+    record.startTime = INFO.startTime;
+    record.endTime = INFO.endTime;
+    record.moves = INFO.moves;
+    record.win = INFO.win ? 1 : 0;
+    for( uint8_t& byte : record.reserved ) {
+        byte = 0;
+    }
+    record.checksum = record.computeChecksum();
+    return record;
+}
+
+SolitaireInfo HistoryRecord::toInfo() const {
+    SolitaireInfo info;
+    info.win = win != 0;
+    info.moves = moves;
+    info.startTime = startTime;
+    info.endTime = endTime;
+    return info;
+}
+
+uint32_t HistoryRecord::computeChecksum() const {
+    // Every byte before the checksum is covered
+    return ::computeChecksum( this, offsetof( HistoryRecord, checksum ) );
+}
+
+bool HistoryRecord::isValid() const {
+    return checksum == computeChecksum();
+}
@@ -0,0 +1,96 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the History Record data structure, which is how a single game
+ * is stored within the history file.
+ */
+
+#ifndef HISTORY_RECORD_H
+#define HISTORY_RECORD_H
+
+#include <cstdint>
+
+#include "SolitaireInfo.h"
+
+/**
+ * @brief A game as stored in the history file. Every field has a fixed
+ * width, so that every record has the same size and can be read straight
+ * out of the file without parsing. Each record carries a checksum of its
+ * own contents, so that a record that was only partially written before
+ * a crash can be told apart from a complete one
+ */
+struct HistoryRecord {
+    /**
+     * @brief The start time of the game, as a unix epoch timestamp
+     */
+    int64_t startTime;
+
+    /**
+     * @brief The end time of the game, as a unix epoch timestamp
+     */
+    int64_t endTime;
+
+    /**
+     * @brief How many moves were performed in the game
+     */
+    uint32_t moves;
+
+    /**
+     * @brief 1 if the game was won, 0 otherwise
+     */
+    uint8_t win;
+
+    /**
+     * @brief Unused space, always written as zero
+     */
+    uint8_t reserved[7];
+
+    /**
+     * @brief The checksum of every other field of the record
+     */
+    uint32_t checksum;
+
+    /**
+     * @brief Create a record of a game, including its checksum
+     * @param INFO The information of the game
+     * @return A record holding the same information
+     */
+    static HistoryRecord fromInfo( const SolitaireInfo INFO );
+
+    /**
+     * @brief Get the game this record holds
+     * @return The information of the game
+     */
+    SolitaireInfo toInfo() const;
+
+    /**
+     * @brief Calculate the checksum of the record
+     * @return A checksum of every field other than the checksum itself
+     */
+    uint32_t computeChecksum() const;
+
+    /**
+     * @brief Check if the record was written completely
+     * @return true if the checksum matches the record, false otherwise
+     */
+    bool isValid() const;
+};
+
+static_assert( sizeof( HistoryRecord ) == 32, "History records must not have padding" );
+
+#endif
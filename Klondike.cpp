@@ -0,0 +1,355 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the Klondike rules engine, which holds the state of a game
+ * and moves cards between its game elements without any knowledge of how they are
+ * displayed.
+ */
+
+#include "Klondike.h"
+
+using namespace std;
+
+#include <ctime>
+#include <random>
+
+Klondike::Klondike() : Klondike( random_device()() ) {
+    // Aliased to a deal with an unpredictable seed
+}
+
+Klondike::Klondike( const uint64_t SEED ) {
+    mSeed = SEED;
+
+    // Shuffle the deck, and then populate the columns from it
+    mGetDeck().shuffle( SEED );
+    for( unsigned int i = 0; i < Column::AMOUNT; ++i ) {
+        mGetColumn( i ).deal();
+    }
+
+    // Initialize game information 
+    mInfo.win = false;
+    mInfo.moves = 0;
+    mInfo.startTime = time( 0 );
+
+    // Currently an ongoing game, so no end time
+    mInfo.endTime = -1;
+}
+
+SolitaireInfo Klondike::getInfo() const {
+    SolitaireInfo info = mInfo;
+    if( info.endTime < 0 ) {
+        // No end time yet, replace it with the current time
+        // to get an "in-progress" elapsed time
+        info.endTime = time( 0 );
+    }
+    return info;
+}
+
+bool Klondike::isWon() const {
+    return mInfo.win;
+}
+
+uint64_t Klondike::getSeed() const {
+    return mSeed;
+}
+
+const GameState& Klondike::getState() const {
+    return mState;
+}
+
+unsigned int Klondike::getSize( const Pile PILE ) const {
+    return mState.getSize( PILE );
+}
+
+unsigned int Klondike::getHiddenSize( const Pile PILE ) const {
+    if( PILE == Pile::STOCK ) {
+        return mState.getSize( PILE );
+    }
+
+    if( PILE >= Pile::COLUMN ) {
+        return mState.getHiddenCount( PILE - Pile::COLUMN );
+    }
+
+    // The waste and foundations are always face up
+    return 0;
+}
+
+Card Klondike::getCard( const Pile PILE, const unsigned int IDX ) const {
+    return mState.getCards( PILE )[IDX];
+}
+
+bool Klondike::canTake( const Pile PILE, const unsigned int COUNT ) const {
+    if( mInfo.win ) {
+        // Already won, no more moves can be done
+        return false;
+    }
+
+    // Only the waste portion of the deck can be taken from
+    if( PILE == Pile::WASTE ) {
+        return mGetDeck().canTake( COUNT );
+    }
+
+    if( PILE >= Pile::FOUNDATION && PILE < Pile::COLUMN ) {
+        return mGetFoundation( (CardSuit) (PILE - Pile::FOUNDATION) ).canTake( COUNT );
+    }
+
+    if( PILE >= Pile::COLUMN && PILE < Pile::PILE_AMOUNT ) {
+        return mGetColumn( PILE - Pile::COLUMN ).canTake( COUNT );
+    }
+
+    return false;
+}
+
+bool Klondike::canMove( const Pile FROM, const unsigned int COUNT, const Pile TO ) const {
+    if( FROM == TO || !canTake( FROM, COUNT ) ) {
+        // Moving cards onto their own pile is a superfluous move
+        return false;
+    }
+
+    // Every pile that can be taken from has its selection led by
+    // the COUNT-th card from the top
+    const Card CARD = mState.getCards( FROM )[mState.getSize( FROM ) - COUNT];
+
+    return canPut( CARD, COUNT, TO );
+}
+
+bool Klondike::canPut( const Card CARD, const unsigned int COUNT, const Pile TO ) const {
+    if( mInfo.win ) {
+        return false;
+    }
+
+    if( TO >= Pile::FOUNDATION && TO < Pile::COLUMN ) {
+        return mGetFoundation( (CardSuit) (TO - Pile::FOUNDATION) ).canPut( CARD, COUNT );
+    }
+
+    if( TO >= Pile::COLUMN && TO < Pile::PILE_AMOUNT ) {
+        return mGetColumn( TO - Pile::COLUMN ).canPut( CARD, COUNT );
+    }
+
+    return false;
+}
+
+bool Klondike::move( const Pile FROM, const unsigned int COUNT, const Pile TO ) {
+    if( !canMove( FROM, COUNT, TO ) ) {
+        return false;
+    }
+
+    mState.move( FROM, COUNT, TO );
+
+    // Taking the last shown cards of a column uncovers a new card
+    if( FROM >= Pile::COLUMN ) {
+        mGetColumn( FROM - Pile::COLUMN ).reveal();
+    }
+
+    mCountMove();
+
+    return true;
+}
+
+bool Klondike::turnStock() {
+    if( mInfo.win ) {
+        return false;
+    }
+
+    mGetDeck().turn();
+
+    // Turning the stock is always a move, even if both portions of the
+    // deck are empty
+    mCountMove();
+
+    return true;
+}
+
+unsigned int Klondike::getLegalMoves( Move* pMoves, const unsigned int CAPACITY ) const {
+    unsigned int amount = 0;
+    if( mInfo.win ) {
+        // Already won, no more moves can be done
+        return amount;
+    }
+
+    // The stock can be turned over as long as the deck has any cards, as
+    // turning an empty deck would change nothing
+    if( amount < CAPACITY 
+        && ( getSize( Pile::STOCK ) > 0 || getSize( Pile::WASTE ) > 0 ) ) {
+        pMoves[amount++] = Move { Pile::STOCK, Pile::WASTE, 1 };
+    }
+
+    // Single cards can go from the waste and the top of any column to
+    // any foundation or column. Only the foundation of the card's own
+    // suit can ever accept it, so the others are not checked.
+    for( unsigned int i = Pile::WASTE; i < Pile::PILE_AMOUNT; ++i ) {
+        const Pile FROM = (Pile) i;
+        if( ( FROM >= Pile::FOUNDATION && FROM < Pile::COLUMN ) 
+            || getSize( FROM ) == 0 ) {
+            continue;
+        }
+
+        const Card TOP = getCard( FROM, getSize( FROM ) - 1 );
+        mAddMove( 
+            FROM, 1, (Pile) (Pile::FOUNDATION + TOP.getSuit()), 
+            pMoves, CAPACITY, amount 
+        );
+
+        if( FROM == Pile::WASTE ) {
+            for( unsigned int j = 0; j < Column::AMOUNT; ++j ) {
+                mAddMove( 
+                    FROM, 1, (Pile) (Pile::COLUMN + j), 
+                    pMoves, CAPACITY, amount 
+                );
+            }
+        }
+    }
+
+    // Runs of shown cards can go from a column to any other column. As
+    // shown cards always descend by one rank at a time, the only run that
+    // can fit a target is the one led by the rank just below the target's
+    // top card, or a run led by a king for an empty target.
+    for( unsigned int i = 0; i < Column::AMOUNT; ++i ) {
+        const Pile FROM = (Pile) (Pile::COLUMN + i);
+        const unsigned int SIZE = getSize( FROM );
+        const unsigned int SHOWN = SIZE - getHiddenSize( FROM );
+        if( SHOWN == 0 ) {
+            continue;
+        }
+
+        const int TOP_RANK = getCard( FROM, SIZE - 1 ).getRank();
+        for( unsigned int j = 0; j < Column::AMOUNT; ++j ) {
+            const Pile TO = (Pile) (Pile::COLUMN + j);
+            const unsigned int TARGET_SIZE = getSize( TO );
+            if( TO == FROM ) {
+                continue;
+            }
+
+            int leadRank = CardRank::KING;
+            if( TARGET_SIZE > 0 ) {
+                leadRank = getCard( TO, TARGET_SIZE - 1 ).getRank() - 1;
+            }
+
+            const int COUNT = leadRank - TOP_RANK + 1;
+            if( COUNT >= 1 && COUNT <= (int) SHOWN ) {
+                mAddMove( FROM, COUNT, TO, pMoves, CAPACITY, amount );
+            }
+        }
+    }
+
+    // The top card of a foundation can go back to any column
+    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
+        for( unsigned int j = 0; j < Column::AMOUNT; ++j ) {
+            mAddMove( 
+                (Pile) (Pile::FOUNDATION + i), 1, (Pile) (Pile::COLUMN + j), 
+                pMoves, CAPACITY, amount 
+            );
+        }
+    }
+
+    return amount;
+}
+
+bool Klondike::apply( const Move MOVE ) {
+    if( MOVE.from == Pile::STOCK ) {
+        return turnStock();
+    }
+
+    return move( (Pile) MOVE.from, MOVE.count, (Pile) MOVE.to );
+}
+
+bool Klondike::revert( const MoveRecord RECORD ) {
+    if( mInfo.win ) {
+        return false;
+    }
+
+    const Pile FROM = (Pile) RECORD.move.from;
+    const Pile TO = (Pile) RECORD.move.to;
+
+    if( FROM == Pile::STOCK ) {
+        if( RECORD.recycled ) {
+            // Every card went back to the stock in reverse, so lay them
+            // back out and flip them over again
+            mState.move( Pile::STOCK, mState.getSize( Pile::STOCK ), Pile::WASTE );
+            mState.reverse( Pile::WASTE );
+        } else {
+            mState.move( Pile::WASTE, 1, Pile::STOCK );
+        }
+    } else {
+        // Cover the revealed card before the moved cards go back on it
+        if( RECORD.revealed ) {
+            const unsigned int NUMBER = FROM - Pile::COLUMN;
+            mState.setHiddenCount( NUMBER, mState.getHiddenCount( NUMBER ) + 1 );
+        }
+
+        mState.move( TO, RECORD.move.count, FROM );
+    }
+
+    // Undoing a move takes back the move it counted
+    --mInfo.moves;
+
+    return true;
+}
+
+// Views only modify the state through their non-const methods, which are
+// only reachable from the non-const methods of this class
+
+Deck Klondike::mGetDeck() const {
+    return Deck( const_cast<GameState&>( mState ) );
+}
+
+Foundation Klondike::mGetFoundation( const CardSuit SUIT ) const {
+    return Foundation( const_cast<GameState&>( mState ), SUIT );
+}
+
+Column Klondike::mGetColumn( const unsigned int NUMBER ) const {
+    return Column( const_cast<GameState&>( mState ), NUMBER );
+}
+
+bool Klondike::mAreAllFoundationsComplete() const {
+    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
+        if( !mGetFoundation( (CardSuit) i ).isComplete() ) {
+            // Not win yet
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Klondike::mCountMove() {
+    ++mInfo.moves;
+
+    if( mAreAllFoundationsComplete() ) {
+        // All foundations are win, the user has won!
+        mInfo.win = true;
+        mInfo.endTime = time( 0 );
+    }
+}
+
+void Klondike::mAddMove( 
+    const Pile FROM, 
+    const unsigned int COUNT, 
+    const Pile TO, 
+    Move* pMoves, 
+    const unsigned int CAPACITY, 
+    unsigned int& amount 
+) const {
+    if( amount < CAPACITY && canMove( FROM, COUNT, TO ) ) {
+        pMoves[amount++] = Move { 
+            (unsigned char) FROM, 
+            (unsigned char) TO, 
+            (unsigned char) COUNT 
+        };
+    }
+}
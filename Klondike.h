@@ -0,0 +1,246 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the Klondike rules engine, which holds the state of a game and
+ * moves cards between its game elements without any knowledge of how they are
+ * displayed.
+ */
+
+#ifndef KLONDIKE_H
+#define KLONDIKE_H
+
+#include <cstdint>
+
+#include "Card.h"
+#include "CardSuit.h"
+#include "Column.h"
+#include "Deck.h"
+#include "Foundation.h"
+#include "GameState.h"
+#include "Move.h"
+#include "MoveRecord.h"
+#include "Pile.h"
+#include "SolitaireInfo.h"
+
+/**
+ * @brief The state and rules of a game of Klondike Solitaire. Every pile is
+ * addressed by a Pile identifier rather than a position in the window.
+ * The whole game is trivially copyable, so positions can be cloned freely
+ */
+class Klondike final {
+public:
+    /**
+     * @brief The largest amount of legal moves that can exist in any
+     * position. A stock turn, the waste to any foundation or column,
+     * each column to a foundation or any other column, and each
+     * foundation to any column
+     */
+    static const unsigned int MAX_MOVES = 1 
+        + (1 + Column::AMOUNT) 
+        + Column::AMOUNT * Column::AMOUNT 
+        + Foundation::AMOUNT * Column::AMOUNT;
+
+    /**
+     * @brief Creates a new game with a randomized deal
+     */
+    Klondike();
+
+    /**
+     * @brief Creates a new game with a particular deal
+     * @param SEED The seed of the deal. The same seed always produces
+     * the same deal
+     */
+    Klondike( const uint64_t SEED );
+
+    /**
+     * @brief Get the seed of the deal of this game
+     * @return The seed, which can be used to re-create the deal
+     */
+    uint64_t getSeed() const;
+
+    /**
+     * @brief Get information about the game
+     * @return A collection of several data points about the current
+     * game
+     */
+    SolitaireInfo getInfo() const;
+
+    /**
+     * @brief Check if the game has been won
+     * @return true if every foundation is complete, false otherwise
+     */
+    bool isWon() const;
+
+    /**
+     * @brief Get the placement of every card in the game
+     * @return The current game state
+     */
+    const GameState& getState() const;
+
+    /**
+     * @brief Get the amount of cards in a pile
+     * @param PILE The pile to check
+     * @return The total amount of cards in the pile, hidden or not
+     */
+    unsigned int getSize( const Pile PILE ) const;
+
+    /**
+     * @brief Get the amount of face down cards in a pile
+     * @param PILE The pile to check
+     * @return The amount of cards at the bottom of the pile that are
+     * face down
+     */
+    unsigned int getHiddenSize( const Pile PILE ) const;
+
+    /**
+     * @brief Get a card in a pile
+     * @param PILE The pile to check
+     * @param IDX The index of the card, in the range [0, getSize( PILE )),
+     * where the last index is the top of the pile
+     * @return The card at IDX
+     */
+    Card getCard( const Pile PILE, const unsigned int IDX ) const;
+
+    /**
+     * @brief Check if cards can be picked up from a pile
+     * @param PILE The pile to take from
+     * @param COUNT The amount of cards to take from the top of the pile
+     * @return true if the cards can be picked up, false otherwise
+     */
+    bool canTake( const Pile PILE, const unsigned int COUNT ) const;
+
+    /**
+     * @brief Check if cards can be moved from one pile to another
+     * @param FROM The pile to take the cards from
+     * @param COUNT The amount of cards to take from the top of FROM
+     * @param TO The pile to place the cards on
+     * @return true if the move is legal, false otherwise
+     */
+    bool canMove( const Pile FROM, const unsigned int COUNT, const Pile TO ) const;
+
+    /**
+     * @brief Check if cards could be put onto a pile, regardless of where
+     * they are now
+     * @param CARD The bottom card of the cards being put down
+     * @param COUNT The amount of cards being put down
+     * @param TO The pile to put the cards onto
+     * @return true if the pile accepts the cards, false otherwise
+     */
+    bool canPut( const Card CARD, const unsigned int COUNT, const Pile TO ) const;
+
+    /**
+     * @brief Move cards from one pile to another, revealing any uncovered
+     * cards
+     * @param FROM The pile to take the cards from
+     * @param COUNT The amount of cards to take from the top of FROM
+     * @param TO The pile to place the cards on
+     * @return true if a move was performed, false if the move was illegal
+     */
+    bool move( const Pile FROM, const unsigned int COUNT, const Pile TO );
+
+    /**
+     * @brief Draw a card from the stock onto the waste, or recycle the
+     * waste back into the stock if the stock is empty
+     * @return true if a move was performed, false otherwise
+     */
+    bool turnStock();
+
+    /**
+     * @brief List every legal move in the current position
+     * @param pMoves The buffer to write the moves to
+     * @param CAPACITY The amount of moves that fit in the buffer. A capacity
+     * of MAX_MOVES will always fit every legal move
+     * @return The amount of moves written to the buffer
+     */
+    unsigned int getLegalMoves( Move* pMoves, const unsigned int CAPACITY ) const;
+
+    /**
+     * @brief Perform a move
+     * @param MOVE The move to perform
+     * @return true if the move was performed, false if it was illegal
+     */
+    bool apply( const Move MOVE );
+
+    /**
+     * @brief Reverse a move, including any card it revealed or any recycle
+     * of the waste. No rules are checked, so this must be the record of the
+     * last move performed on this game that has not been reverted yet
+     * @param RECORD The record of the move to reverse
+     * @return true if the move was reversed, false if the game is already
+     * won and so can no longer change
+     */
+    bool revert( const MoveRecord RECORD );
+
+private:
+    GameState mState;
+    SolitaireInfo mInfo;
+    uint64_t mSeed;
+
+    /**
+     * @brief Get a view over the deck of this game
+     * @return A deck view
+     */
+    Deck mGetDeck() const;
+
+    /**
+     * @brief Get a view over a foundation of this game
+     * @param SUIT The suit of the foundation
+     * @return A foundation view
+     */
+    Foundation mGetFoundation( const CardSuit SUIT ) const;
+
+    /**
+     * @brief Get a view over a column of this game
+     * @param NUMBER The number of the column
+     * @return A column view
+     */
+    Column mGetColumn( const unsigned int NUMBER ) const;
+
+    /**
+     * @brief Check if all foundations are complete in this game
+     * (i.e the win condition)
+     * @return true if the foundations are complete, false otherwise
+     */
+    bool mAreAllFoundationsComplete() const;
+
+    /**
+     * @brief Count a move, ending the game if it was won
+     */
+    void mCountMove();
+
+    /**
+     * @brief Write a move to a buffer if it is legal and fits
+     * @param FROM The pile to take the cards from
+     * @param COUNT The amount of cards to take from the top of FROM
+     * @param TO The pile to place the cards on
+     * @param pMoves The buffer to write the move to
+     * @param CAPACITY The amount of moves that fit in the buffer
+     * @param amount The amount of moves already in the buffer, which is
+     * incremented if the move was written
+     */
+    void mAddMove( 
+        const Pile FROM, 
+        const unsigned int COUNT, 
+        const Pile TO, 
+        Move* pMoves, 
+        const unsigned int CAPACITY, 
+        unsigned int& amount 
+    ) const;
+};
+
+#endif
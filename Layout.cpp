@@ -0,0 +1,167 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the table layout, which decides where each pile of cards is
+ * displayed in the window.
+ */
+
+#include "Layout.h"
+
+using namespace sf;
+using namespace std;
+
+#include <algorithm>
+
+#include "CardSprite.h"
+#include "Column.h"
+
+const int Layout::STRIDE = CardSprite::WIDTH + MARGIN;
+const int Layout::SLOT_AMOUNT = Column::AMOUNT;
+const int Layout::FOUNDATION_SLOT = Pile::FOUNDATION + 1;
+
+Vector2i Layout::getPosition( const Pile PILE, const unsigned int IDX ) {
+    const int WIDTH = CardSprite::WIDTH;
+    const int HEIGHT = CardSprite::HEIGHT;
+
+    if( PILE < Pile::COLUMN ) {
+        // The deck is placed in the top left corner, while the
+        // foundations are placed within the top right, leaving a
+        // gap of one card between them
+        int slot = PILE;
+        if( PILE >= Pile::FOUNDATION ) {
+            slot = FOUNDATION_SLOT + (PILE - Pile::FOUNDATION);
+        }
+
+        return Vector2i( MARGIN + slot * (WIDTH + MARGIN), MARGIN );
+    }
+
+    // Columns are placed below, with each card fanning out
+    // downwards so that every shown card is visible
+    return Vector2i(
+        MARGIN + (PILE - Pile::COLUMN) * (WIDTH + MARGIN),
+        MARGIN * 2 + HEIGHT + FAN_OFFSET * IDX
+    );
+}
+
+IntRect Layout::getBounds( const Pile PILE, const unsigned int IDX, const unsigned int TOTAL ) {
+    const Vector2i POS = getPosition( PILE, IDX );
+    IntRect bounds( POS.x, POS.y, CardSprite::WIDTH, CardSprite::HEIGHT );
+
+    // Cards that are not at the bottom of a column are only
+    // 24 pixels tall instead of the typical card height,
+    // so this must be reflected in the bounds as well
+    const bool IS_MULTIPLE = TOTAL > 1;
+    const bool IS_BEHIND = IDX < TOTAL - 1;
+    if( PILE >= Pile::COLUMN && IS_MULTIPLE && IS_BEHIND ) {
+        bounds.height = FAN_OFFSET;
+    }
+
+    return bounds;
+}
+
+IntRect Layout::getTotalBounds( const Pile PILE, const unsigned int TOTAL ) {
+    const Vector2i POS = getPosition( PILE, 0 );
+    IntRect bounds( POS.x, POS.y, CardSprite::WIDTH, CardSprite::HEIGHT );
+
+    if( PILE >= Pile::COLUMN ) {
+        // Total card amount is unsigned, so we want to make sure
+        // we don't underflow with empty columns and create absurdly
+        // tall bounds
+        bounds.height += FAN_OFFSET * min( TOTAL - 1, TOTAL );
+    }
+
+    return bounds;
+}
+
+bool Layout::getPileAt( const Vector2i POS, Pile& pile ) {
+    // Every slot is a card wide, followed by a margin that belongs to no
+    // pile, so the slot is found by dividing by the width of both
+    const int X = POS.x - MARGIN;
+    if( X < 0 || X % STRIDE >= (int) CardSprite::WIDTH || X / STRIDE >= SLOT_AMOUNT ) {
+        return false;
+    }
+
+    const int SLOT = X / STRIDE;
+    const int COLUMN_TOP = MARGIN * 2 + CardSprite::HEIGHT;
+    if( POS.y >= COLUMN_TOP ) {
+        pile = (Pile) (Pile::COLUMN + SLOT);
+        return true;
+    }
+
+    if( POS.y >= MARGIN && POS.y < MARGIN + (int) CardSprite::HEIGHT ) {
+        return mGetTopPile( SLOT, pile );
+    }
+
+    return false;
+}
+
+unsigned int Layout::getIndexAt( const Pile PILE, const Vector2i POS, const unsigned int TOTAL ) {
+    if( TOTAL == 0 || !getTotalBounds( PILE, TOTAL ).contains( POS ) ) {
+        return TOTAL;
+    }
+
+    if( PILE < Pile::COLUMN ) {
+        // Only the top card is visible
+        return TOTAL - 1;
+    }
+
+    // Every card but the last only shows a strip of FAN_OFFSET pixels, so
+    // the card is found by dividing by that, with anything further down
+    // belonging to the fully visible last card
+    const unsigned int IDX = (POS.y - getPosition( PILE, 0 ).y) / FAN_OFFSET;
+    return min( IDX, TOTAL - 1 );
+}
+
+unsigned int Layout::getDropTargets( const IntRect BOUNDS, Pile* pPiles ) {
+    // A slot overlaps the bounds if it starts before the bounds end and
+    // ends after the bounds start. Shifting by a whole stride keeps the
+    // divisions on non-negative values, where they round down, for any
+    // bounds near the table. Bounds further left are clamped away.
+    const int START = BOUNDS.left - MARGIN + STRIDE;
+    const int FIRST = max( (START - (int) CardSprite::WIDTH) / STRIDE, 0 );
+    const int LAST = min( (START + BOUNDS.width - 1) / STRIDE - 1, SLOT_AMOUNT - 1 );
+
+    unsigned int amount = 0;
+    for( int i = FIRST; i <= LAST; ++i ) {
+        Pile pile;
+        if( mGetTopPile( i, pile ) && pile >= Pile::FOUNDATION ) {
+            pPiles[amount++] = pile;
+        }
+    }
+
+    for( int i = FIRST; i <= LAST; ++i ) {
+        pPiles[amount++] = (Pile) (Pile::COLUMN + i);
+    }
+
+    return amount;
+}
+
+bool Layout::mGetTopPile( const int SLOT, Pile& pile ) {
+    if( SLOT >= FOUNDATION_SLOT ) {
+        pile = (Pile) (Pile::FOUNDATION + (SLOT - FOUNDATION_SLOT));
+        return true;
+    }
+
+    if( SLOT <= Pile::WASTE ) {
+        pile = (Pile) SLOT;
+        return true;
+    }
+
+    // The gap between the deck and the foundations
+    return false;
+}
@@ -0,0 +1,135 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the table layout, which decides where each pile of cards is
+ * displayed in the window.
+ */
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <SFML/Graphics.hpp>
+
+#include "Pile.h"
+
+/**
+ * @brief The positions of every pile of cards within the window. Piles are
+ * laid out on a fixed grid of slots, so the pile and card at any point can
+ * be found directly rather than by testing every card
+ */
+class Layout final {
+public:
+    /**
+     * @brief The spacing between piles and the window edges, in pixels
+     */
+    static const int MARGIN = 16;
+
+    /**
+     * @brief The vertical offset between fanned out cards, in pixels
+     */
+    static const int FAN_OFFSET = 24;
+
+    /**
+     * @brief The most piles that getDropTargets can return
+     */
+    static const unsigned int MAX_DROP_TARGETS = 4;
+
+    /**
+     * @brief Get the position of a card within a pile
+     * @param PILE The pile of the card
+     * @param IDX The index of the card within the pile. Only columns fan
+     * out their cards, so this is ignored for all other piles
+     * @return The top left corner of the card in the window
+     */
+    static sf::Vector2i getPosition( const Pile PILE, const unsigned int IDX );
+
+    /**
+     * @brief Get the clickable bounds of a card within a pile
+     * @param PILE The pile of the card
+     * @param IDX The index of the card, in the range [0, TOTAL)
+     * @param TOTAL The amount of cards displayed in the pile
+     * @return A rect representing the visible area of the card
+     */
+    static sf::IntRect getBounds( const Pile PILE, const unsigned int IDX, const unsigned int TOTAL );
+
+    /**
+     * @brief Get the bounds of an entire pile
+     * @param PILE The pile
+     * @param TOTAL The amount of cards displayed in the pile
+     * @return A rect representing the bounds of the pile as is displayed
+     * in the window
+     */
+    static sf::IntRect getTotalBounds( const Pile PILE, const unsigned int TOTAL );
+
+    /**
+     * @brief Find the pile displayed at a point
+     * @param POS The point in the window
+     * @param pile The pile to write to. Columns are treated as reaching the
+     * bottom of the window, regardless of how many cards they display
+     * @return true if a pile was found, false if POS is not on any pile
+     */
+    static bool getPileAt( const sf::Vector2i POS, Pile& pile );
+
+    /**
+     * @brief Find the card of a pile displayed at a point
+     * @param PILE The pile to check
+     * @param POS The point in the window
+     * @param TOTAL The amount of cards displayed in the pile
+     * @return The index of the card at POS, or TOTAL if POS is not on
+     * any card of the pile
+     */
+    static unsigned int getIndexAt( const Pile PILE, const sf::Vector2i POS, const unsigned int TOTAL );
+
+    /**
+     * @brief Find the piles that a dragged card could be dropped on
+     * @param BOUNDS The bounds of the dragged cards, which must be no wider
+     * than a card. This can only overlap two adjacent slots, and so only
+     * the foundation and column of those slots
+     * @param pPiles The buffer to write the piles to, which must fit
+     * MAX_DROP_TARGETS piles. Foundations are written before columns, and
+     * piles further left before piles further right
+     * @return The amount of piles written
+     */
+    static unsigned int getDropTargets( const sf::IntRect BOUNDS, Pile* pPiles );
+
+private:
+    /**
+     * @brief The distance between the left edges of two adjacent slots
+     */
+    static const int STRIDE;
+
+    /**
+     * @brief The amount of slots in each row of the grid
+     */
+    static const int SLOT_AMOUNT;
+
+    /**
+     * @brief The slot of the first foundation in the top row
+     */
+    static const int FOUNDATION_SLOT;
+
+    /**
+     * @brief Get the pile of a slot in the top row
+     * @param SLOT The slot, in the range [0, SLOT_AMOUNT)
+     * @param pile The pile to write to
+     * @return true if the slot has a pile, false if it is the gap
+     */
+    static bool mGetTopPile( const int SLOT, Pile& pile );
+};
+
+#endif
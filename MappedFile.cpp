@@ -0,0 +1,111 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the mapped file, which gives read access to the contents of
+ * a file without copying them into memory.
+ */
+
+#include "MappedFile.h"
+
+using namespace std;
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() {
+    mPData = nullptr;
+    mSize = 0;
+    mIsMapped = false;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open( const char* PATH ) {
+    close();
+
+#ifdef _WIN32
+    // Fall back to reading the whole file where mmap is not available
+    ifstream fileIn( PATH, ios::binary );
+    if( fileIn.fail() ) {
+        return false;
+    }
+
+    mBuffer.assign( istreambuf_iterator<char>( fileIn ), istreambuf_iterator<char>() );
+    mPData = mBuffer.data();
+    mSize = mBuffer.size();
+#else
+    const int FD = ::open( PATH, O_RDONLY );
+    if( FD < 0 ) {
+        return false;
+    }
+
+    struct stat status;
+    if( fstat( FD, &status ) != 0 ) {
+        ::close( FD );
+        return false;
+    }
+
+    // Mapping nothing is an error, so empty files are left unmapped
+    mSize = status.st_size;
+    if( mSize > 0 ) {
+        void* pMapping = mmap( nullptr, mSize, PROT_READ, MAP_PRIVATE, FD, 0 );
+        if( pMapping == MAP_FAILED ) {
+            ::close( FD );
+            mSize = 0;
+            return false;
+        }
+
+        mPData = static_cast<const char*>( pMapping );
+        mIsMapped = true;
+    }
+
+    // The mapping stays valid after the file is closed
+    ::close( FD );
+#endif
+
+    return true;
+}
+
+void MappedFile::close() {
+#ifndef _WIN32
+    if( mIsMapped ) {
+        munmap( const_cast<char*>( mPData ), mSize );
+    }
+#endif
+
+    mBuffer.clear();
+    mPData = nullptr;
+    mSize = 0;
+    mIsMapped = false;
+}
+
+const char* MappedFile::getData() const {
+    return mPData;
+}
+
+unsigned long MappedFile::getSize() const {
+    return mSize;
+}
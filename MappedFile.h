@@ -0,0 +1,80 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the mapped file, which gives read access to the contents of a
+ * file without copying them into memory.
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <vector>
+
+/**
+ * @brief A read-only view of the contents of a file. Where the system
+ * supports it, the file is memory mapped, so that its pages are only read
+ * from disk as they are accessed. Otherwise, the file is read into memory
+ */
+class MappedFile final {
+public:
+    /**
+     * @brief Create a mapped file with no file open
+     */
+    MappedFile();
+
+    /**
+     * @brief Unmap the file, if any
+     */
+    ~MappedFile();
+
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile& operator=( const MappedFile& ) = delete;
+
+    /**
+     * @brief Map a file, replacing any file that is currently mapped
+     * @param PATH The path of the file to map
+     * @return true if the file was mapped, false if it could not be opened
+     */
+    bool open( const char* PATH );
+
+    /**
+     * @brief Unmap the current file, if any
+     */
+    void close();
+
+    /**
+     * @brief Get the contents of the file
+     * @return A pointer to the first byte of the file, valid until the file
+     * is closed. This may be null for an empty file
+     */
+    const char* getData() const;
+
+    /**
+     * @brief Get the size of the file
+     * @return The size in bytes
+     */
+    unsigned long getSize() const;
+
+private:
+    const char* mPData;
+    unsigned long mSize;
+    bool mIsMapped;
+    std::vector<char> mBuffer;
+};
+
+#endif
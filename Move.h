@@ -0,0 +1,49 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the Move data structure, which describes a single move of cards
+ * between two piles.
+ */
+
+#ifndef MOVE_H
+#define MOVE_H
+
+/**
+ * @brief A move of one or more cards between two piles. Values are
+ * stored as bytes so that large amounts of moves can be kept cheaply
+ */
+struct Move {
+    /**
+     * @brief The Pile the cards are taken from. Moves from the STOCK
+     * turn the stock over onto the waste, or recycle the waste if the
+     * stock is empty
+     */
+    unsigned char from;
+
+    /**
+     * @brief The Pile the cards are placed on
+     */
+    unsigned char to;
+
+    /**
+     * @brief The amount of cards taken from the top of the source pile
+     */
+    unsigned char count;
+};
+
+#endif
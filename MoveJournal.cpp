@@ -0,0 +1,88 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the move journal, which records the moves of a game so that
+ * they can be undone and redone.
+ */
+
+#include "MoveJournal.h"
+
+using namespace std;
+
+#include "Pile.h"
+
+MoveJournal::MoveJournal() {
+    mRecords.reserve( INITIAL_CAPACITY );
+    mPosition = 0;
+}
+
+bool MoveJournal::apply( Klondike& game, const Move MOVE ) {
+    // The side effects of a move are found by comparing the game before
+    // and after it, so the rules only live in the game itself
+    const Pile FROM = (Pile) MOVE.from;
+    const unsigned int HIDDEN_SIZE = game.getHiddenSize( FROM );
+    const bool IS_RECYCLE = FROM == Pile::STOCK && game.getSize( Pile::STOCK ) == 0;
+
+    if( !game.apply( MOVE ) ) {
+        return false;
+    }
+
+    MoveRecord record;
+    record.move = MOVE;
+    record.revealed = FROM >= Pile::COLUMN && game.getHiddenSize( FROM ) < HIDDEN_SIZE;
+    record.recycled = IS_RECYCLE;
+
+    // A new move replaces any moves that were undone before it. Shrinking
+    // the records never frees them, so this does not allocate
+    mRecords.resize( mPosition );
+    mRecords.push_back( record );
+    ++mPosition;
+
+    return true;
+}
+
+bool MoveJournal::undo( Klondike& game ) {
+    if( mPosition == 0 || !game.revert( mRecords[mPosition - 1] ) ) {
+        return false;
+    }
+
+    --mPosition;
+    return true;
+}
+
+bool MoveJournal::redo( Klondike& game ) {
+    if( mPosition == mRecords.size() || !game.apply( mRecords[mPosition].move ) ) {
+        return false;
+    }
+
+    ++mPosition;
+    return true;
+}
+
+bool MoveJournal::canUndo() const {
+    return mPosition > 0;
+}
+
+bool MoveJournal::canRedo() const {
+    return mPosition < mRecords.size();
+}
+
+void MoveJournal::clear() {
+    mRecords.clear();
+    mPosition = 0;
+}
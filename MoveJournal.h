@@ -0,0 +1,97 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the move journal, which records the moves of a game so that
+ * they can be undone and redone.
+ */
+
+#ifndef MOVE_JOURNAL_H
+#define MOVE_JOURNAL_H
+
+#include <vector>
+
+#include "Klondike.h"
+#include "Move.h"
+#include "MoveRecord.h"
+
+/**
+ * @brief An unlimited undo and redo history for a game. Every performed
+ * move is kept as a small record of what it changed, rather than a copy
+ * of the game, so undoing only touches the cards that were moved. Undone
+ * moves are kept until a new move is performed, so that they can be redone
+ */
+class MoveJournal final {
+public:
+    /**
+     * @brief Create an empty journal
+     */
+    MoveJournal();
+
+    /**
+     * @brief Perform a move on a game and record it. Any undone moves can
+     * no longer be redone afterwards
+     * @param game The game to perform the move on, which must be the game
+     * every other recorded move was performed on
+     * @param MOVE The move to perform
+     * @return true if the move was performed, false if it was illegal
+     */
+    bool apply( Klondike& game, const Move MOVE );
+
+    /**
+     * @brief Undo the most recently performed move
+     * @param game The game the move was performed on
+     * @return true if a move was undone, false if there was nothing to undo
+     */
+    bool undo( Klondike& game );
+
+    /**
+     * @brief Redo the most recently undone move
+     * @param game The game the move was undone on
+     * @return true if a move was redone, false if there was nothing to redo
+     */
+    bool redo( Klondike& game );
+
+    /**
+     * @brief Check if there is a move to undo
+     * @return true if undo will succeed on a game that is still in progress
+     */
+    bool canUndo() const;
+
+    /**
+     * @brief Check if there is a move to redo
+     * @return true if redo will succeed
+     */
+    bool canRedo() const;
+
+    /**
+     * @brief Forget every recorded move, keeping the storage
+     */
+    void clear();
+
+private:
+    /**
+     * @brief The amount of records to make room for up front, which is
+     * more than most games ever need
+     */
+    static const unsigned int INITIAL_CAPACITY = 1024;
+
+    std::vector<MoveRecord> mRecords;
+    unsigned int mPosition;
+};
+
+#endif
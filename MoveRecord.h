@@ -0,0 +1,51 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the Move Record data structure, which describes a move that was
+ * performed along with its side effects, so that it can be undone.
+ */
+
+#ifndef MOVE_RECORD_H
+#define MOVE_RECORD_H
+
+#include "Move.h"
+
+/**
+ * @brief A move that was performed on a game, along with everything needed
+ * to reverse it. This is a few bytes, so that entire games can be recorded
+ * cheaply
+ */
+struct MoveRecord {
+    /**
+     * @brief The move as it was performed
+     */
+    Move move;
+
+    /**
+     * @brief Whether moving cards off of a column revealed the card below
+     */
+    bool revealed;
+
+    /**
+     * @brief Whether turning the stock recycled the waste back into the
+     * stock instead of drawing a card
+     */
+    bool recycled;
+};
+
+#endif
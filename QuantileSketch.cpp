@@ -0,0 +1,123 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the Quantile Sketch data structure, which approximates the
+ * distribution of a set of values in a fixed amount of memory.
+ */
+
+#include "QuantileSketch.h"
+
+using namespace std;
+
+#include <cmath>
+
+// Each doubling of the values is split into this many buckets, and values
+// below twice this get a bucket of their own
+static const unsigned int SUB_BUCKET_BITS = 4;
+static const unsigned int SUB_BUCKET_AMOUNT = 1 << SUB_BUCKET_BITS;
+static const unsigned int EXACT_AMOUNT = SUB_BUCKET_AMOUNT * 2;
+static const unsigned int EXACT_BITS = SUB_BUCKET_BITS + 1;
+
+/**
+ * @brief Find the bucket a value is counted in
+ * @param VALUE The value
+ * @return The index of the bucket
+ */
+static unsigned int getBucket( const uint64_t VALUE ) {
+    if( VALUE < EXACT_AMOUNT ) {
+        return VALUE;
+    }
+
+    // Shifting by the full width of the value is undefined, so the
+    // highest bit is never shifted past
+    unsigned int bits = EXACT_BITS;
+    while( bits < 63 && (VALUE >> (bits + 1)) != 0 ) {
+        ++bits;
+    }
+
+    // The highest bits after the leading one pick the bucket within
+    // this doubling
+    const unsigned int SUB_BUCKET = (VALUE >> (bits - SUB_BUCKET_BITS)) - SUB_BUCKET_AMOUNT;
+    const unsigned int BUCKET = EXACT_AMOUNT + (bits - EXACT_BITS) * SUB_BUCKET_AMOUNT + SUB_BUCKET;
+    if( BUCKET >= QuantileSketch::BUCKET_AMOUNT ) {
+        return QuantileSketch::BUCKET_AMOUNT - 1;
+    }
+
+    return BUCKET;
+}
+
+/**
+ * @brief Find the value that best stands for the values in a bucket
+ * @param BUCKET The index of the bucket
+ * @return The middle of the values counted in the bucket
+ */
+static uint64_t getBucketValue( const unsigned int BUCKET ) {
+    if( BUCKET < EXACT_AMOUNT ) {
+        return BUCKET;
+    }
+
+    const unsigned int BITS = EXACT_BITS + (BUCKET - EXACT_AMOUNT) / SUB_BUCKET_AMOUNT;
+    const uint64_t SUB_BUCKET = (BUCKET - EXACT_AMOUNT) % SUB_BUCKET_AMOUNT;
+    const uint64_t WIDTH = (uint64_t) 1 << (BITS - SUB_BUCKET_BITS);
+    return (SUB_BUCKET_AMOUNT + SUB_BUCKET) * WIDTH + WIDTH / 2;
+}
+
+void QuantileSketch::add( const uint64_t VALUE ) {
+    ++counts[getBucket( VALUE )];
+}
+
+void QuantileSketch::merge( const QuantileSketch& OTHER ) {
+    for( unsigned int i = 0; i < BUCKET_AMOUNT; ++i ) {
+        counts[i] += OTHER.counts[i];
+    }
+}
+
+uint64_t QuantileSketch::getCount() const {
+    uint64_t count = 0;
+    for( unsigned int i = 0; i < BUCKET_AMOUNT; ++i ) {
+        count += counts[i];
+    }
+
+    return count;
+}
+
+uint64_t QuantileSketch::getQuantile( const double QUANTILE ) const {
+    const uint64_t COUNT = getCount();
+    if( COUNT == 0 ) {
+        return 0;
+    }
+
+    // The value at the quantile is the one with this many values at or
+    // below it, counting from one
+    uint64_t rank = (uint64_t) ceil( QUANTILE * COUNT );
+    if( rank < 1 ) {
+        rank = 1;
+    } else if( rank > COUNT ) {
+        rank = COUNT;
+    }
+
+    uint64_t seen = 0;
+    for( unsigned int i = 0; i < BUCKET_AMOUNT; ++i ) {
+        seen += counts[i];
+        if( seen >= rank ) {
+            return getBucketValue( i );
+        }
+    }
+
+    return getBucketValue( BUCKET_AMOUNT - 1 );
+}
@@ -0,0 +1,75 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the Quantile Sketch data structure, which approximates the
+ * distribution of a set of values in a fixed amount of memory.
+ */
+
+#ifndef QUANTILE_SKETCH_H
+#define QUANTILE_SKETCH_H
+
+#include <cstdint>
+
+/**
+ * @brief An approximate distribution of non-negative values, from which
+ * quantiles such as the median can be read. Values are counted in buckets
+ * that are exact for small values and then grow with the values, so that
+ * every value is known to within about 3% while the sketch keeps the same
+ * size no matter how many values are added. Sketches of separate sets of
+ * values can be merged into the sketch of both. Every field has a fixed
+ * width, so that sketches can be stored in files as they are
+ */
+struct QuantileSketch {
+    /**
+     * @brief The amount of buckets that values are counted in
+     */
+    static const unsigned int BUCKET_AMOUNT = 336;
+
+    /**
+     * @brief The amount of values in each bucket
+     */
+    uint32_t counts[BUCKET_AMOUNT];
+
+    /**
+     * @brief Add a value to the sketch. Values larger than about 16
+     * million are counted as the largest value the sketch knows
+     * @param VALUE The value to add
+     */
+    void add( const uint64_t VALUE );
+
+    /**
+     * @brief Add every value of another sketch to this sketch
+     * @param OTHER The sketch to merge
+     */
+    void merge( const QuantileSketch& OTHER );
+
+    /**
+     * @brief Get the amount of values in the sketch
+     * @return The amount of values that were added
+     */
+    uint64_t getCount() const;
+
+    /**
+     * @brief Find the value at a given quantile of the sketch
+     * @param QUANTILE The quantile, from 0 to 1, such as 0.5 for the median
+     * @return The approximate value, or 0 if the sketch has no values
+     */
+    uint64_t getQuantile( const double QUANTILE ) const;
+};
+
+#endif
@@ -0,0 +1,77 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the random number generator, which allows deals to be
+ * reproduced from a seed on any platform.
+ */
+
+#include "Random.h"
+
+/**
+ * @brief Rotate the bits of a value to the left
+ * @param VALUE The value to rotate
+ * @param SHIFT The amount of bits to rotate by, in the range (0, 64)
+ * @return The rotated value
+ */
+static uint64_t rotateLeft( const uint64_t VALUE, const int SHIFT ) {
+    return (VALUE << SHIFT) | (VALUE >> (64 - SHIFT));
+}
+
+Random::Random( const uint64_t SEED ) {
+    // xoshiro must not be seeded with an all-zero state, and neighboring
+    // seeds should give unrelated streams, so the state is instead filled
+    // with successive SplitMix64 outputs
+    uint64_t splitMix = SEED;
+    for( unsigned int i = 0; i < 4; ++i ) {
+        splitMix += 0x9e3779b97f4a7c15ULL;
+        uint64_t z = splitMix;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        mState[i] = z ^ (z >> 31);
+    }
+}
+
+uint64_t Random::next() {
+    const uint64_t RESULT = rotateLeft( mState[1] * 5, 7 ) * 9;
+    const uint64_t SHIFTED = mState[1] << 17;
+
+    mState[2] ^= mState[0];
+    mState[3] ^= mState[1];
+    mState[1] ^= mState[2];
+    mState[0] ^= mState[3];
+
+    mState[2] ^= SHIFTED;
+    mState[3] = rotateLeft( mState[3], 45 );
+
+    return RESULT;
+}
+
+uint64_t Random::nextBelow( const uint64_t BOUND ) {
+    // Taking a value modulo the bound would favor lower values, so values
+    // from the incomplete range at the bottom of the stream are rejected.
+    // The size of that range is 2^64 mod BOUND, which is computed without
+    // overflow as (2^64 - BOUND) mod BOUND.
+    const uint64_t THRESHOLD = (0 - BOUND) % BOUND;
+
+    uint64_t value;
+    do {
+        value = next();
+    } while( value < THRESHOLD );
+
+    return value % BOUND;
+}
@@ -16,45 +16,47 @@
  * - Confirmed proper project formatting from Professor Paone
  *
  * This program implements a game of klondike solitaire. This file implements the
- * the Selectable game element interface, which allows game elements to handle
- * click events.
+ * the interface of the random number generator, which allows deals to be
+ * reproduced from a seed on any platform.
  */
 
-#ifndef SELECTABLE_H
-#define SELECTABLE_H
+#ifndef RANDOM_H
+#define RANDOM_H
 
-#include <SFML/Graphics.hpp>
-
-#include "Selection.h"
+#include <cstdint>
 
 /**
- * @brief An game element that can be selected
+ * @brief A small, fast pseudo-random number generator. This implements
+ * xoshiro256** (https://prng.di.unimi.it/), with its state expanded
+ * from a 64-bit seed by SplitMix64. Both are fully specified by their
+ * reference implementations, so a seed produces the same stream on every
+ * platform and standard library. Instances share no state, so each
+ * thread can use its own generator
  */
-class ISelectable {
+class Random final {
 public:
-    virtual ~ISelectable() {}
+    /**
+     * @brief Create a generator
+     * @param SEED The seed of the generated stream
+     */
+    Random( const uint64_t SEED );
 
     /**
-     * @brief Called when the element might have been clicked on by the mouse
-     * @param MOUSE_POS The position in the window that the mouse clicked
-     * @param pSelection A selection that can be populated if the mouse has
-     * picked up cards from the element. This should be allocated on the
-     * free store
-     * @return true if a *move* was performed, false otherwise. An element
-     * can leave pSelection unpopulated and still return true to signify that
-     * a move occurred
+     * @brief Generate the next value in the stream
+     * @return A uniformly distributed 64-bit value
      */
-    virtual bool click( const sf::Vector2i MOUSE_POS, Selection*& pSelection ) = 0;
+    uint64_t next();
 
     /**
-     * @brief Called when a selection obtained from this element has been
-     * released
-     * @param pSelection The selection. This should be deleted and reset by
-     * the element
-     * @param RETURN Whether the selection is being returned to the element
-     * or not
+     * @brief Generate a value within a range, without any modulo bias
+     * @param BOUND The exclusive upper bound of the range, which must be
+     * non-zero
+     * @return A uniformly distributed value in the range [0, BOUND)
      */
-    virtual void release( Selection*& pSelection ) = 0;
+    uint64_t nextBelow( const uint64_t BOUND );
+
+private:
+    uint64_t mState[4];
 };
 
-#endif
\ No newline at end of file
+#endif
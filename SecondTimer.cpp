@@ -0,0 +1,118 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the second timer, which wakes the window whenever the clock
+ * of the game can show a new second.
+ */
+
+#include "SecondTimer.h"
+
+using namespace std;
+
+#include <chrono>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif !defined( __APPLE__ )
+#include <X11/Xlib.h>
+#endif
+
+SecondTimer::SecondTimer( const sf::WindowHandle HANDLE ) 
+    : mHandle( HANDLE ), mIsActive( true ), mIsStopped( false ), 
+        mThread( &SecondTimer::mRun, this ) {
+}
+
+SecondTimer::~SecondTimer() {
+    {
+        lock_guard<mutex> guard( mLock );
+        mIsStopped = true;
+    }
+
+    mChanged.notify_one();
+    mThread.join();
+}
+
+void SecondTimer::setActive( const bool IS_ACTIVE ) {
+    {
+        lock_guard<mutex> guard( mLock );
+        if( mIsActive == IS_ACTIVE ) {
+            return;
+        }
+
+        mIsActive = IS_ACTIVE;
+    }
+
+    mChanged.notify_one();
+}
+
+void SecondTimer::mRun() {
+    unique_lock<mutex> guard( mLock );
+    while( !mIsStopped ) {
+        if( !mIsActive ) {
+            mChanged.wait( guard );
+            continue;
+        }
+
+        // The game time is counted in whole seconds of the system clock,
+        // so it can only change when the system clock starts a new one
+        const chrono::system_clock::time_point NEXT_SECOND = 
+            chrono::time_point_cast<chrono::seconds>( chrono::system_clock::now() ) 
+            + chrono::seconds( 1 );
+        if( mChanged.wait_until( guard, NEXT_SECOND ) == cv_status::timeout 
+            && mIsActive && !mIsStopped ) {
+            mWake();
+        }
+    }
+}
+
+void SecondTimer::mWake() const {
+#ifdef _WIN32
+    // The cursor is reported as moving to where it already is, along with
+    // the buttons that are really held, so that nothing it does changes
+    POINT point;
+    GetCursorPos( &point );
+    ScreenToClient( mHandle, &point );
+
+    WPARAM buttons = 0;
+    if( GetAsyncKeyState( VK_LBUTTON ) < 0 ) {
+        buttons |= MK_LBUTTON;
+    }
+    if( GetAsyncKeyState( VK_RBUTTON ) < 0 ) {
+        buttons |= MK_RBUTTON;
+    }
+
+    PostMessage( mHandle, WM_MOUSEMOVE, buttons, MAKELPARAM( point.x, point.y ) );
+#elif !defined( __APPLE__ )
+    // The window belongs to the connection of SFML, which is not shared
+    // with other threads, so the event is sent over a connection of our own
+    // and delivered to the window's connection by the server
+    static Display* pDisplay = XOpenDisplay( nullptr );
+    if( pDisplay == nullptr ) {
+        return;
+    }
+
+    XEvent event = {};
+    event.xcrossing.type = EnterNotify;
+    event.xcrossing.window = mHandle;
+    event.xcrossing.mode = NotifyNormal;
+    event.xcrossing.detail = NotifyAncestor;
+    event.xcrossing.same_screen = True;
+    XSendEvent( pDisplay, mHandle, False, NoEventMask, &event );
+    XFlush( pDisplay );
+#endif
+}
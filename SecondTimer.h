@@ -0,0 +1,87 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the second timer, which wakes the window whenever the clock
+ * of the game can show a new second.
+ */
+
+#ifndef SECOND_TIMER_H
+#define SECOND_TIMER_H
+
+#include <SFML/Window.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Wakes a window blocked in waitEvent whenever the system clock
+ * reaches a new second, so that the window can wait for input and still
+ * show the game time as it changes. SFML can neither wait for an event
+ * with a timeout nor post an event of its own, so the timer sends the
+ * window an event through the operating system instead, which SFML reports
+ * as MouseEntered on X11 and as MouseMoved to where the cursor already is
+ * on Windows. Other platforms are not woken
+ */
+class SecondTimer final {
+public:
+    /**
+     * @brief Start waking a window, which must outlive the timer
+     * @param HANDLE The system handle of the window
+     */
+    SecondTimer( const sf::WindowHandle HANDLE );
+
+    /**
+     * @brief Stop waking the window
+     */
+    ~SecondTimer();
+
+    SecondTimer( const SecondTimer& ) = delete;
+    SecondTimer& operator=( const SecondTimer& ) = delete;
+
+    /**
+     * @brief Set whether the window should be woken. A timer that is not
+     * active waits without waking the window until it is made active again
+     * @param IS_ACTIVE true to wake the window every second, false to stop
+     */
+    void setActive( const bool IS_ACTIVE );
+
+private:
+    /**
+     * @brief Wake the window at every new second until the timer is
+     * destroyed, run on its own thread
+     */
+    void mRun();
+
+    /**
+     * @brief Send the window an event that makes waitEvent return
+     */
+    void mWake() const;
+
+    sf::WindowHandle mHandle;
+
+    std::mutex mLock;
+    std::condition_variable mChanged;
+    bool mIsActive;
+    bool mIsStopped;
+
+    // Started last, once everything it uses is set up
+    std::thread mThread;
+};
+
+#endif
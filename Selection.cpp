@@ -23,74 +23,78 @@
 #include "Selection.h"
 
 using namespace sf;
-using namespace std;
 
-Selection::Selection(
-    const unsigned int ID, 
+#include "CardSprite.h"
+#include "Layout.h"
+
+Selection::Selection() {
+    mPile = Pile::STOCK;
+    mCount = 0;
+}
+
+void Selection::select(
+    const Klondike& GAME,
+    const Pile PILE,
+    const unsigned int COUNT,
     const Vector2i ELEMENT_POS, 
-    const Vector2i MOUSE_POS, 
-    const list<Card> CARDS
+    const Vector2i MOUSE_POS
 ) {
-    mId = ID;
+    mPile = PILE;
+    mCount = COUNT;
     mMousePos = MOUSE_POS;
     mOffset = ELEMENT_POS - MOUSE_POS;
-    mCards = CARDS;
-}
 
-unsigned int Selection::getId() const {
-    return mId;
+    // The selected cards cannot change while they are held, so they are
+    // laid out a single time
+    const unsigned int FIRST = GAME.getSize( PILE ) - COUNT;
+    for( unsigned int i = 0; i < COUNT; ++i ) {
+        CardSprite( GAME.getCard( PILE, FIRST + i ) ).intoVertices( 
+            &mVertices[i * 4],
+            Vector2i( 0, Layout::FAN_OFFSET * i )
+        );
+    }
 }
 
-bool Selection::intersects( const IntRect BOUNDS ) const {
-    const Vector2i TRUE_POS = mGetTruePos();
-
-    const IntRect THIS_BOUNDS(
-        TRUE_POS.x,
-        TRUE_POS.y,
-        Card::WIDTH,
-        Card::HEIGHT + (24 * (mCards.size() - 1))
-    );
+void Selection::clear() {
+    mCount = 0;
+}
 
-    return THIS_BOUNDS.intersects( BOUNDS );
+bool Selection::isEmpty() const {
+    return mCount == 0;
 }
 
-void Selection::setMousePosition( const Vector2i MOUSE_POS ) {
-    mMousePos = MOUSE_POS;
+Pile Selection::getPile() const {
+    return mPile;
 }
 
-bool Selection::isConsumed() const {
-    return mCards.size() == 0;
+unsigned int Selection::getCount() const {
+    return mCount;
 }
 
-bool Selection::hasMultipleCards() const {
-    return mCards.size() > 1;
+IntRect Selection::getBounds() const {
+    const Vector2i TRUE_POS = mGetTruePos();
+
+    return IntRect(
+        TRUE_POS.x,
+        TRUE_POS.y,
+        CardSprite::WIDTH,
+        CardSprite::HEIGHT + (Layout::FAN_OFFSET * (mCount - 1))
+    );
 }
 
-Card Selection::getTop() const {
-    return mCards.front();
+bool Selection::intersects( const IntRect BOUNDS ) const {
+    return getBounds().intersects( BOUNDS );
 }
 
-void Selection::consume( list<Card>& dst, list<Card>::const_iterator dstPos ) {
-    dst.splice( dstPos, mCards, mCards.begin(), mCards.end() );
+void Selection::setMousePosition( const Vector2i MOUSE_POS ) {
+    mMousePos = MOUSE_POS;
 }
 
 void Selection::draw( RenderTarget& target, RenderStates states ) const {
-    VertexArray vertices( Quads, 4 );
-
-    int i = 0;
-    const Vector2i TRUE_POS = mGetTruePos();
-    for( Card card : mCards ) {
-        card.intoVertices( 
-            vertices,
-            Vector2i(
-                TRUE_POS.x,
-                TRUE_POS.y + 24 * i
-            )
-        );
-
-        target.draw( vertices, states );
-        ++i;
-    }
+    // The cards were laid out from the origin, so they only need to be
+    // shifted to where the selection currently is
+    states.transform.translate( Vector2f( mGetTruePos() ) );
+    target.draw( mVertices, mCount * 4, Quads, states );
 }
 
 Vector2i Selection::mGetTruePos() const {
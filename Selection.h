@@ -25,85 +25,99 @@
 
 #include <SFML/Graphics.hpp>
 
-#include <list>
-
-#include "Card.h"
+#include "CardRank.h"
+#include "Klondike.h"
+#include "Pile.h"
 
 /**
- * @brief A draggable selection of one or more cards
+ * @brief A draggable selection of one or more cards. The selected cards
+ * stay within their pile until the selection is dropped, and are only
+ * displayed by the selection in the meantime. The cards are laid out once
+ * when selected, and are then only moved along with the mouse. A single
+ * selection is reused for every drag, and holds its vertices inline, so
+ * that dragging cards never allocates
  */
 class Selection final : public sf::Drawable {
 public:
     /**
-     * @brief Create a selection.
-     * @param ID The unique ID for this selection that can be used to
-     * avoid selections created by a game element from being dropped on
-     * the same game element
-     * @param ELEMENT_POS The position of the element that created the
-     * selection
-     * @param MOUSE_POS The position of the mouse when the selection was
-     * created
-     * @param CARDS The cards to select
+     * @brief The most cards that can be selected at once, which is a
+     * full run from a king down to an ace
+     */
+    static const unsigned int MAX_COUNT = CardRank::KING + 1;
+
+    /**
+     * @brief Create an empty selection
+     */
+    Selection();
+
+    /**
+     * @brief Select cards, replacing any previous selection
+     * @param GAME The game that the cards were selected from
+     * @param PILE The pile the cards were selected from. This can be used
+     * to avoid selections from being dropped on the same pile
+     * @param COUNT The amount of cards selected from the top of the pile,
+     * at most MAX_COUNT
+     * @param ELEMENT_POS The position of the first selected card
+     * @param MOUSE_POS The position of the mouse when the cards were
+     * selected
      */
-    Selection(
-        const unsigned int ID, 
+    void select(
+        const Klondike& GAME,
+        const Pile PILE,
+        const unsigned int COUNT,
         const sf::Vector2i ELEMENT_POS, 
-        const sf::Vector2i MOUSE_POS, 
-        const std::list<Card> CARDS
+        const sf::Vector2i MOUSE_POS
     );
 
     /**
-     * @brief Get the ID of this selection. This can be used to identify
-     * the game element that was originally selected.
-     * @return A unique ID
+     * @brief Deselect every card
      */
-    unsigned int getId() const;
+    void clear();
 
     /**
-     * @brief Check if this selection intersects with a bounded rect
-     * @param BOUNDS The bounds to check
+     * @brief Check if any cards are selected
+     * @return true if nothing is selected, false otherwise
      */
-    bool intersects( const sf::IntRect BOUNDS ) const;
+    bool isEmpty() const;
 
     /**
-     * @brief Update the mouse position of the selection
-     * @param MOUSE_POS The position of the mouse on the window
+     * @brief Get the pile that this selection was taken from
+     * @return The source pile
      */
-    void setMousePosition( const sf::Vector2i MOUSE_POS );
+    Pile getPile() const;
 
     /**
-     * @brief Check if this selection is consumed
-     * @return true if the selection is consumed (has no cards), false
-     * otherwise
+     * @brief Get the amount of cards in this selection
+     * @return The amount of cards selected from the top of the pile
      */
-    bool isConsumed() const;
+    unsigned int getCount() const;
 
     /**
-     * @brief Check if this selection has multiple cards
-     * @return true if the selection has multiple cards, false otherwise
+     * @brief Get the area covered by this selection
+     * @return The bounds of every selected card together
      */
-    bool hasMultipleCards() const;
+    sf::IntRect getBounds() const;
 
     /**
-     * @brief Get the visual "top" of the selection
-     * @return The front value within the internal list of cards 
+     * @brief Check if this selection intersects with a bounded rect
+     * @param BOUNDS The bounds to check
      */
-    Card getTop() const;
+    bool intersects( const sf::IntRect BOUNDS ) const;
 
     /**
-     * @brief Consume the selection into a destination list of cards
-     * @param dst The destination list of cards
-     * @param dstPos The iterator position at which to append the cards
+     * @brief Update the mouse position of the selection
+     * @param MOUSE_POS The position of the mouse on the window
      */
-    void consume( std::list<Card>& dst, std::list<Card>::const_iterator dstPos );
+    void setMousePosition( const sf::Vector2i MOUSE_POS );
 
     void draw( sf::RenderTarget& target, sf::RenderStates states ) const override;
 
 private:
-    unsigned int mId;
+    Pile mPile;
+    unsigned int mCount;
     sf::Vector2i mMousePos;
     sf::Vector2i mOffset;
-    std::list<Card> mCards;
+    sf::Vertex mVertices[MAX_COUNT * 4];
 
     /**
      * @brief Get the "true" position of the selection, taking into account
@@ -113,4 +127,4 @@ private:
     sf::Vector2i mGetTruePos() const;
 };
 
-#endif
\ No newline at end of file
+#endif
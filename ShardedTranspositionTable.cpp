@@ -0,0 +1,65 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the sharded transposition table, which records which
+ * positions have been searched by any of several threads.
+ */
+
+#include "ShardedTranspositionTable.h"
+
+using namespace std;
+
+ShardedTranspositionTable::ShardedTranspositionTable( const unsigned int THREAD_AMOUNT ) {
+    // The shard is chosen by the upper bits of a hash, as the lower bits
+    // already pick the slot within each shard, so the amount of shards is
+    // rounded up to a power of two
+    unsigned int shardAmount = 1;
+    mShift = 64;
+    if( THREAD_AMOUNT > 1 ) {
+        while( shardAmount < THREAD_AMOUNT * SHARDS_PER_THREAD ) {
+            shardAmount <<= 1;
+            --mShift;
+        }
+    }
+
+    mShards = vector<Shard>( shardAmount );
+}
+
+bool ShardedTranspositionTable::insert( const uint64_t HASH ) {
+    // Shifting by the full width is undefined, so a single shard is
+    // handled separately
+    Shard& shard = mShift < 64 ? mShards[HASH >> mShift] : mShards[0];
+
+    lock_guard<mutex> guard( shard.lock );
+    return shard.table.insert( HASH );
+}
+
+void ShardedTranspositionTable::clear() {
+    for( Shard& shard : mShards ) {
+        shard.table.clear();
+    }
+}
+
+unsigned long ShardedTranspositionTable::getSize() const {
+    unsigned long size = 0;
+    for( const Shard& SHARD : mShards ) {
+        size += SHARD.table.getSize();
+    }
+
+    return size;
+}
@@ -0,0 +1,88 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the sharded transposition table, which records which positions
+ * have been searched by any of several threads.
+ */
+
+#ifndef SHARDED_TRANSPOSITION_TABLE_H
+#define SHARDED_TRANSPOSITION_TABLE_H
+
+#include <mutex>
+#include <vector>
+
+#include <cstdint>
+
+#include "TranspositionTable.h"
+
+/**
+ * @brief A set of position hashes that can be shared between threads. The
+ * hashes are split across several independent tables by their upper bits,
+ * each guarded by its own lock, so that threads recording different
+ * positions rarely wait on each other. There are a few tables for every
+ * thread, and each only allocates once it is used
+ */
+class ShardedTranspositionTable final {
+public:
+    /**
+     * @brief Create an empty table
+     * @param THREAD_AMOUNT The amount of threads that will use the table. A
+     * table used by a single thread is not split
+     */
+    ShardedTranspositionTable( const unsigned int THREAD_AMOUNT );
+
+    /**
+     * @brief Record a position. This is safe to call from several threads
+     * @param HASH The hash of the position
+     * @return true if the position was newly recorded, false if it was
+     * already in the table
+     */
+    bool insert( const uint64_t HASH );
+
+    /**
+     * @brief Remove every position from the table. This must not be called
+     * while other threads use the table
+     */
+    void clear();
+
+    /**
+     * @brief Get the amount of recorded positions. This must not be called
+     * while other threads use the table
+     * @return The size of the table
+     */
+    unsigned long getSize() const;
+
+private:
+    /**
+     * @brief The least amount of independent tables for every thread
+     */
+    static const unsigned int SHARDS_PER_THREAD = 4;
+
+    /**
+     * @brief One independent part of the table
+     */
+    struct Shard {
+        std::mutex lock;
+        TranspositionTable table;
+    };
+
+    std::vector<Shard> mShards;
+    unsigned int mShift;
+};
+
+#endif
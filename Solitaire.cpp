@@ -24,195 +24,205 @@
 
 using namespace sf;
 
-#include <ctime>
-
+#include "Card.h"
+#include "CardSprite.h"
 #include "CardSuit.h"
+#include "Column.h"
+#include "Foundation.h"
+#include "Layout.h"
+#include "Move.h"
 
-Solitaire::Solitaire() {
-    // Create (and shuffle) a deck
-    mPDeck = new Deck();
-
-    // Create empty founds
-    mPPFoundations = new Foundation*[Foundation::AMOUNT];
-    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
-        mPPFoundations[i] = new Foundation( (CardSuit) i );
-    }
-
-    // Create foundations and populate them with the deck
-    mPPColumns = new Column*[Column::AMOUNT];
-    for( unsigned int i = 0; i < Column::AMOUNT; ++i ) {
-        mPPColumns[i] = new Column( i, *mPDeck );
-    }
-
-    mPSelected = nullptr;
-
-    // Initialize game information 
-    mInfo.win = false;
-    mInfo.moves = 0;
-    mInfo.startTime = time( 0 );
+Solitaire::Solitaire() : mVertices( Quads, QUAD_AMOUNT * 4 ) {
+    mMarkAllDirty();
+}
 
-    // Currently an ongoing game, so no end time
-    mInfo.endTime = -1;
+Solitaire::Solitaire( const uint64_t SEED ) 
+    : mGame( SEED ), mVertices( Quads, QUAD_AMOUNT * 4 ) {
+    mMarkAllDirty();
 }
 
-Solitaire::Solitaire( const Solitaire& OTHER ) {
-    mCopyFrom( OTHER );
+SolitaireInfo Solitaire::getInfo() const {
+    return mGame.getInfo();
 }
 
-Solitaire& Solitaire::operator=( const Solitaire& OTHER ) {
-    if( this == &OTHER ) {
-        return *this;
+void Solitaire::click( const Vector2i MOUSE_POS ) {
+    if( mGame.getInfo().win ) {
+        // Already won, no more moves can be done
+        return;
     }
 
-    mClear();
-    mCopyFrom( OTHER );
+    mClick( MOUSE_POS );
 
-    return *this;    
+    if( !mSelection.isEmpty() ) {
+        // The selected cards are no longer shown by their pile
+        mMarkDirty( mSelection.getPile() );
+    }
 }
 
-Solitaire::~Solitaire() {
-    mClear();
+bool Solitaire::hasSelection() const {
+    return !mSelection.isEmpty();
 }
 
-SolitaireInfo Solitaire::getInfo() const {
-    SolitaireInfo info = mInfo;
-    if( info.endTime < 0 ) {
-        // No end time yet, replace it with the current time
-        // to get an "in-progress" elapsed time
-        info.endTime = time( 0 );
-    }
-    return info;
+void Solitaire::drag( const Vector2i MOUSE_POS ) {
+    mSelection.setMousePosition( MOUSE_POS );
 }
 
-void Solitaire::click( const Vector2i MOUSE_POS, Selection*& pSelection ) {
-    if( mInfo.win ) {
-        // Already won, no more moves can be done
-        return;
-    }
+void Solitaire::release() {
+    // If the selection was not dropped, it simply remains
+    // within the pile it was taken from
+    mDrop();
+    mMarkDirty( mSelection.getPile() );
+    mSelection.clear();
+}
 
-    if( mClick( MOUSE_POS, pSelection ) ) {
-        ++mInfo.moves;
-    }
+bool Solitaire::undo() {
+    // Any two piles may have changed, which is too rare to track closely
+    mMarkAllDirty();
+    return mJournal.undo( mGame );
 }
 
-void Solitaire::release( Selection*& pSelection ) {
-    if( mDrop( *pSelection ) ) {
-        // Successfully dropping a selection is always a move
-        ++mInfo.moves;
+bool Solitaire::redo() {
+    mMarkAllDirty();
+    return mJournal.redo( mGame );
+}
+
+void Solitaire::draw( RenderTarget& target, RenderStates states ) const {
+    for( unsigned int i = 0; i < Pile::PILE_AMOUNT; ++i ) {
+        if( mDirtyPiles & (1 << i) ) {
+            mUpdateVertices( (Pile) i );
+        }
     }
+    mDirtyPiles = 0;
 
-    // Signal the previously selected element that the
-    // selection was released. If the selection was not
-    // dropped, it will be returned to the element.
-    mPSelected->release( pSelection );
-    mPSelected = nullptr;
+    target.draw( mVertices, states );
 
-    if( mAreAllFoundationsComplete() ) {
-        // All foundations are win, the user has won!
-        mInfo.win = true;
-        mInfo.endTime = time( 0 );
+    if( !mSelection.isEmpty() ) {
+        // Selections are drawn last, as they should not clip behind
+        // any other game elements
+        target.draw( mSelection, states );
     }
 }
 
-void Solitaire::draw( RenderTarget& target, RenderStates states ) const {
-	target.draw( *mPDeck, states );
-
-    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
-        target.draw( *mPPFoundations[i], states );
-    }
+void Solitaire::mMarkDirty( const Pile PILE ) {
+    mDirtyPiles |= 1 << PILE;
+}
 
-    for( unsigned int i = 0; i < Column::AMOUNT; ++i ) {
-        target.draw( *mPPColumns[i], states );
-    }
+void Solitaire::mMarkAllDirty() {
+    mDirtyPiles = (1 << Pile::PILE_AMOUNT) - 1;
 }
 
-void Solitaire::mClear() {
-    delete mPDeck;
+void Solitaire::mUpdateVertices( const Pile PILE ) const {
+    const unsigned int SIZE = mGetDisplayedSize( PILE );
+    const Vector2i POS = Layout::getPosition( PILE, 0 );
+
+    if( PILE < Pile::COLUMN ) {
+        // Other piles only have a single quad showing their top card, or
+        // a placeholder when empty
+        Vertex* pVertices = &mVertices[PILE * 4];
+
+        if( PILE == Pile::STOCK ) {
+            // Always show a placeholder for the stock
+            CardSprite( SIZE > 0 ).intoVertices( pVertices, POS );
+        } else if( SIZE > 0 ) {
+            CardSprite( mGame.getCard( PILE, SIZE - 1 ) ).intoVertices( pVertices, POS );
+        } else if( PILE == Pile::WASTE ) {
+            CardSprite( false ).intoVertices( pVertices, POS );
+        } else {
+            CardSprite( (CardSuit) (PILE - Pile::FOUNDATION) ).intoVertices( pVertices, POS );
+        }
 
-    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
-        delete mPPFoundations[i];
+        return;
     }
-    delete[] mPPFoundations;
 
-    for( unsigned int i = 0; i < Column::AMOUNT; ++i ) {
-        delete mPPColumns[i];
-    }
-    delete[] mPPColumns;
-}
+    const unsigned int HIDDEN_SIZE = mGame.getHiddenSize( PILE );
+    Vertex* pVertices = &mVertices[(Pile::COLUMN + (PILE - Pile::COLUMN) * COLUMN_CAPACITY) * 4];
+    for( unsigned int i = 0; i < COLUMN_CAPACITY; ++i ) {
+        if( i >= SIZE ) {
+            // Collapse unused quads to a point, so that nothing is drawn
+            for( unsigned int j = 0; j < 4; ++j ) {
+                pVertices[i * 4 + j].position = Vector2f( 0, 0 );
+            }
+            continue;
+        }
 
-void Solitaire::mCopyFrom( const Solitaire& OTHER ) {
-    mPDeck = new Deck( *OTHER.mPDeck );
+        // Use a placeholder when drawing all hidden cards
+        CardSprite card( true );
+        if( i >= HIDDEN_SIZE ) {
+            card = CardSprite( mGame.getCard( PILE, i ) );
+        }
 
-    mPPFoundations = new Foundation*[Foundation::AMOUNT];
-    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
-        mPPFoundations[i] = new Foundation( *OTHER.mPPFoundations[i] );
+        card.intoVertices( pVertices + i * 4, Layout::getPosition( PILE, i ) );
     }
+}
 
-    mPPColumns = new Column*[Column::AMOUNT];
-    for( unsigned int i = 0; i < Column::AMOUNT; ++i ) {
-        mPPColumns[i] = new Column( *OTHER.mPPColumns[i] );
+unsigned int Solitaire::mGetDisplayedSize( const Pile PILE ) const {
+    const unsigned int SIZE = mGame.getSize( PILE );
+    if( !mSelection.isEmpty() && mSelection.getPile() == PILE ) {
+        // Selected cards are drawn by the selection instead
+        return SIZE - mSelection.getCount();
     }
 
-    mInfo = OTHER.mInfo;
+    return SIZE;
 }
 
-bool Solitaire::mClick( const Vector2i MOUSE_POS, Selection*& pSelection ) {
-    // We have to simultaniously check if a move was performed or if
-    // a selection was created. If either occurs, we are done checking.
-
-    bool moved = mPDeck->click( MOUSE_POS, pSelection );
-    if( moved || pSelection != nullptr ) {
-        mPSelected = mPDeck;
-        return moved;
+void Solitaire::mClick( const Vector2i MOUSE_POS ) {
+    Pile pile;
+    if( !Layout::getPileAt( MOUSE_POS, pile ) ) {
+        return;
     }
 
-    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
-        moved = mPPFoundations[i]->click( MOUSE_POS, pSelection );
-        if( moved || pSelection != nullptr ) {
-            mPSelected = mPPFoundations[i];
-            return moved;
-        }
+    if( pile == Pile::STOCK ) {
+        // Clicked the stock, draw a card
+        mJournal.apply( mGame, Move { Pile::STOCK, Pile::WASTE, 1 } );
+        mMarkDirty( Pile::STOCK );
+        mMarkDirty( Pile::WASTE );
+        return;
     }
 
-    for( unsigned int i = 0; i < Column::AMOUNT; ++i ) {
-        moved = mPPColumns[i]->click( MOUSE_POS, pSelection );
-        if( moved || pSelection != nullptr ) {
-            mPSelected = mPPColumns[i];
-            return moved;
-        }
+    const unsigned int SIZE = mGame.getSize( pile );
+    const unsigned int IDX = Layout::getIndexAt( pile, MOUSE_POS, SIZE );
+    if( IDX == SIZE ) {
+        return;
     }
 
-    return moved;
+    // Found a card that is within the mouse bounds, select this
+    // card *and* any following cards
+    if( mGame.canTake( pile, SIZE - IDX ) ) {
+        const IntRect BOUNDS = Layout::getBounds( pile, IDX, SIZE );
+        mSelection.select( 
+            mGame,
+            pile,
+            SIZE - IDX,
+            Vector2i( BOUNDS.left, BOUNDS.top ), 
+            MOUSE_POS
+        );
+    }
 }
 
-bool Solitaire::mDrop( Selection& selection ) {
-    // Unlike in click, we only need to check if the selection was
-    // consumed.
-
-    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
-        mPPFoundations[i]->drop( selection );
-        if( selection.isConsumed() ) {
-            return true;
+bool Solitaire::mDrop() {
+    // Only the piles in the slots under the selection can be dropped on.
+    // Foundations are checked before columns, so that a card that
+    // could go either way is preferably placed on a foundation
+    Pile piles[Layout::MAX_DROP_TARGETS];
+    const unsigned int AMOUNT = Layout::getDropTargets( mSelection.getBounds(), piles );
+    for( unsigned int i = 0; i < AMOUNT; ++i ) {
+        const Pile PILE = piles[i];
+        const IntRect BOUNDS = Layout::getTotalBounds( PILE, mGame.getSize( PILE ) );
+        if( !mSelection.intersects( BOUNDS ) ) {
+            // Not in bounds
+            continue;
         }
-    }
 
-    for( unsigned int i = 0; i < Column::AMOUNT; ++i ) {
-        mPPColumns[i]->drop( selection );
-        if( selection.isConsumed() ) {
+        const Move MOVE { 
+            (unsigned char) mSelection.getPile(), 
+            (unsigned char) PILE, 
+            (unsigned char) mSelection.getCount() 
+        };
+        if( mJournal.apply( mGame, MOVE ) ) {
+            mMarkDirty( PILE );
             return true;
         }
     }
 
     return false;
 }
-
-bool Solitaire::mAreAllFoundationsComplete() {
-    for( unsigned int i = 0; i < Foundation::AMOUNT; ++i ) {
-        if( !mPPFoundations[i]->isComplete() ) {
-            // Not win yet
-            return false;
-        }
-    }
-
-    return true;
-}
\ No newline at end of file
@@ -24,15 +24,22 @@
 
 #include <SFML/Graphics.hpp>
 
-#include "Deck.h"
+#include <cstdint>
+
+#include "CardRank.h"
 #include "Column.h"
-#include "Foundation.h"
-#include "ISelectable.h"
+#include "Klondike.h"
+#include "MoveJournal.h"
+#include "Pile.h"
 #include "Selection.h"
 #include "SolitaireInfo.h"
 
 /**
- * @brief A game of (Klondike) Solitaire
+ * @brief A game of (Klondike) Solitaire, as displayed in a window.
+ * This translates mouse input into moves on the underlying rules
+ * engine. The whole table is kept in a single vertex array with a
+ * fixed range of quads for every pile, and only piles that changed
+ * since the last frame are laid out again
  */
 class Solitaire final : public sf::Drawable {
 public:
@@ -40,9 +47,12 @@ public:
      * @brief Creates a new solitaire game with a randomized deal 
      */
     Solitaire();
-    Solitaire( const Solitaire& OTHER );
-    Solitaire& operator=( const Solitaire& OTHER );
-    ~Solitaire();
+
+    /**
+     * @brief Creates a new solitaire game with a particular deal
+     * @param SEED The seed of the deal
+     */
+    Solitaire( const uint64_t SEED );
 
     /**
      * @brief Get information about the game
@@ -52,62 +62,99 @@ public:
     SolitaireInfo getInfo() const;
     
     /**
-     * @brief Forward a mouse click event into the game
+     * @brief Forward a mouse click event into the game, which may pick up
+     * some cards
      * @param MOUSE_POS The position in the window that the mouse clicked
-     * @param pSelection A selection that may be populated if the click
-     * event will pick up some cards
      */
-    void click( const sf::Vector2i MOUSE_POS, Selection*& pSelection );
+    void click( const sf::Vector2i MOUSE_POS );
+
+    /**
+     * @brief Check if any cards are currently picked up
+     * @return true if cards are being dragged, false otherwise
+     */
+    bool hasSelection() const;
 
     /**
-     * @brief Release a selection of cards into the game
-     * @param pSelection A non-null selection of cards.
+     * @brief Move the picked up cards along with the mouse
+     * @param MOUSE_POS The position of the mouse on the window
      */
-    void release( Selection*& pSelection );
+    void drag( const sf::Vector2i MOUSE_POS );
+
+    /**
+     * @brief Release the picked up cards into the game
+     */
+    void release();
+
+    /**
+     * @brief Take back the most recent move
+     * @return true if a move was taken back, false otherwise
+     */
+    bool undo();
+
+    /**
+     * @brief Perform the most recently taken back move again
+     * @return true if a move was performed, false otherwise
+     */
+    bool redo();
 
     void draw( sf::RenderTarget& target, sf::RenderStates states ) const override;
 
 private:
-    Deck* mPDeck;
-    Foundation** mPPFoundations; 
-    Column** mPPColumns;
-    ISelectable* mPSelected;
-    SolitaireInfo mInfo;
+    /**
+     * @brief The most cards a column can hold, which is every hidden card
+     * of the last column with a full run of shown cards on top
+     */
+    static const unsigned int COLUMN_CAPACITY = (Column::AMOUNT - 1) + (CardRank::KING + 1);
 
     /**
-     * @brief Clears and de-allocates this game
+     * @brief The amount of quads in the table. Every pile other than the
+     * columns only ever shows its top card
      */
-    void mClear();
+    static const unsigned int QUAD_AMOUNT = Pile::COLUMN + Column::AMOUNT * COLUMN_CAPACITY;
+
+    Klondike mGame;
+    MoveJournal mJournal;
+    Selection mSelection;
+    mutable sf::VertexArray mVertices;
+    mutable unsigned int mDirtyPiles;
 
     /**
-     * @brief Copy the state of another game into this one
-     * @param OTHER Another solitaire game
+     * @brief Mark a pile as changed, so that it is laid out again before
+     * the next draw
+     * @param PILE The pile that changed
      */
-    void mCopyFrom( const Solitaire& OTHER );
+    void mMarkDirty( const Pile PILE );
 
     /**
-     * @brief Attempt to forward a click event to any game elements
-     * @param MOUSE_POS The position in the window that the mouse clicked
-     * @param pSelection A selection that may be populated if the click
-     * event will pick up some cards
-     * @return true if a *move* was done, false otherwise. A move may
-     * be done without pSelection being populated
+     * @brief Mark every pile as changed
      */
-    bool mClick( const sf::Vector2i MOUSE_POS, Selection*& pSelection );
+    void mMarkAllDirty();
 
     /**
-     * @brief Attempt to drop a selection into any game elements
-     * @param selection The selection to drop
-     * @return true if the selection was consumed, false otherwise
+     * @brief Lay out the quads of a pile from its current cards
+     * @param PILE The pile to lay out
+     */
+    void mUpdateVertices( const Pile PILE ) const;
+
+    /**
+     * @brief Get the amount of cards in a pile that are not currently
+     * selected
+     * @param PILE The pile to check
+     * @return The amount of cards that are displayed in the pile
+     */
+    unsigned int mGetDisplayedSize( const Pile PILE ) const;
+
+    /**
+     * @brief Attempt to pick up cards from any pile into the selection
+     * @param MOUSE_POS The position in the window that the mouse clicked
      */
-    bool mDrop( Selection& selection );
+    void mClick( const sf::Vector2i MOUSE_POS );
 
     /**
-     * @brief Check if all foundations are complete in this game
-     * (i.e the win condition)
-     * @return true if the foundations are complete, false otherwise
+     * @brief Attempt to drop the selection onto any pile
+     * @return true if the selection was moved, false otherwise
      */
-    bool mAreAllFoundationsComplete();
+    bool mDrop();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,558 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the solver, which searches a deal for a winning sequence
+ * of moves.
+ */
+
+#include "Solver.h"
+
+using namespace std;
+
+#include <algorithm>
+#include <thread>
+
+#include "Card.h"
+#include "CardRank.h"
+#include "CardSuit.h"
+#include "Pile.h"
+
+Solver::Solver( const unsigned long NODE_LIMIT ) : Solver( NODE_LIMIT, 1 ) {
+    // Aliased to a solver with only the calling thread
+}
+
+Solver::Solver( const unsigned long NODE_LIMIT, const unsigned int THREAD_AMOUNT ) 
+    : mTable( THREAD_AMOUNT > 0 ? THREAD_AMOUNT : 1 ), 
+      mWorkers( THREAD_AMOUNT > 0 ? THREAD_AMOUNT : 1 ) {
+    mNodeLimit = NODE_LIMIT;
+    mNodes = 0;
+    mPendingTasks = 0;
+    mQueuedTasks = 0;
+    mIdleWorkers = 0;
+    mStopped = false;
+    mLimitReached = false;
+    mPruned = false;
+    mWon = false;
+}
+
+SolverResult Solver::solve( const Klondike& GAME ) {
+    mNodes = 0;
+    mTable.clear();
+    mStopped = false;
+    mLimitReached = false;
+    mPruned = false;
+    mWon = false;
+    mSolution.clear();
+    mPathNodes.clear();
+
+    for( Worker& worker : mWorkers ) {
+        worker.tasks.clear();
+        worker.nodes = 0;
+    }
+
+    mWorkers[0].tasks.push_back( Task { GAME, EMPTY_PATH } );
+    mPendingTasks = 1;
+    mQueuedTasks = 1;
+    mIdleWorkers = 0;
+
+    // The calling thread works alongside the others instead of waiting
+    vector<thread> threads;
+    for( unsigned int i = 1; i < mWorkers.size(); ++i ) {
+        threads.push_back( thread( &Solver::mWork, this, i ) );
+    }
+
+    mWork( 0 );
+    for( thread& t : threads ) {
+        t.join();
+    }
+
+    if( mWon ) {
+        return SolverResult::WINNABLE;
+    }
+
+    if( mLimitReached || mPruned ) {
+        return SolverResult::UNDECIDED;
+    }
+
+    return SolverResult::UNWINNABLE;
+}
+
+const vector<Move>& Solver::getSolution() const {
+    return mSolution;
+}
+
+unsigned long Solver::getNodeCount() const {
+    return mNodes;
+}
+
+void Solver::mWork( const unsigned int NUMBER ) {
+    Worker& worker = mWorkers[NUMBER];
+    Task task;
+
+    // Every task is counted as pending from when it is queued until it is
+    // fully searched, and searching a task queues its shared moves before
+    // finishing. Once nothing is pending, no more work can appear.
+    while( !mStopped && mPendingTasks > 0 ) {
+        if( !mTakeTask( NUMBER, task ) ) {
+            // Sleep until a task is queued or the search is over. Both are
+            // only announced after taking the idle lock, so neither can
+            // slip in between checking for them and starting to wait
+            unique_lock<mutex> guard( mIdleLock );
+            ++mIdleWorkers;
+            while( !mStopped && mPendingTasks > 0 && mQueuedTasks == 0 ) {
+                mTasksChanged.wait( guard );
+            }
+            --mIdleWorkers;
+            continue;
+        }
+
+        worker.pathRoot = task.pathNode;
+        mTruncatePath( worker, 0 );
+        mSearch( worker, task.game );
+        if( --mPendingTasks == 0 ) {
+            mWakeIdle();
+        }
+    }
+
+    mFlushNodes( worker );
+}
+
+bool Solver::mTakeTask( const unsigned int NUMBER, Task& task ) {
+    // The newest task of a worker's own queue is the deepest, which keeps
+    // its search depth-first. Other workers steal the oldest task instead,
+    // as it is the shallowest and so likely the largest.
+    for( unsigned int i = 0; i < mWorkers.size(); ++i ) {
+        Worker& victim = mWorkers[(NUMBER + i) % mWorkers.size()];
+
+        lock_guard<mutex> guard( victim.lock );
+        if( victim.tasks.empty() ) {
+            continue;
+        }
+
+        if( i == 0 ) {
+            task = move( victim.tasks.back() );
+            victim.tasks.pop_back();
+        } else {
+            task = move( victim.tasks.front() );
+            victim.tasks.pop_front();
+        }
+
+        --mQueuedTasks;
+        return true;
+    }
+
+    return false;
+}
+
+void Solver::mSearch( Worker& worker, const Klondike& GAME ) {
+    const unsigned int PATH_SIZE = worker.path.size();
+
+    // Positions are kept on a stack of frames owned by the worker instead
+    // of recursing, as every position holds its whole list of candidate
+    // moves, which a deep game would otherwise pile onto the thread stack.
+    // The frames are kept between searches, so they are only allocated
+    // while the worker reaches new depths.
+    if( worker.frames.empty() ) {
+        worker.frames.resize( 1 );
+    }
+
+    worker.frames[0].game = GAME;
+    mExpand( worker, worker.frames[0] );
+    unsigned int depth = 1;
+
+    while( depth > 0 ) {
+        // Make room for a child first, as growing the stack moves frames
+        if( worker.frames.size() <= depth ) {
+            worker.frames.resize( depth + 1 );
+        }
+
+        Frame& frame = worker.frames[depth - 1];
+        if( mStopped || frame.next >= frame.amount ) {
+            --depth;
+            continue;
+        }
+
+        // Only share work when there are more idle workers than tasks
+        // waiting for them, so that the queues do not fill up with
+        // positions this worker would have reached anyway
+        if( frame.next + 1 < frame.amount && mQueuedTasks < mIdleWorkers ) {
+            mTruncatePath( worker, frame.pathSize );
+            mShareMoves( 
+                worker, 
+                frame.game, 
+                frame.moves + frame.next + 1, 
+                frame.turns + frame.next + 1, 
+                frame.amount - frame.next - 1 
+            );
+            frame.amount = frame.next + 1;
+        }
+
+        Frame& child = worker.frames[depth];
+        child.game = frame.game;
+        mTruncatePath( worker, frame.pathSize );
+        mApplyMove( child.game, frame.moves[frame.next], frame.turns[frame.next] );
+        mAppendMove( worker.path, frame.moves[frame.next], frame.turns[frame.next] );
+        ++frame.next;
+
+        mExpand( worker, child );
+        ++depth;
+    }
+
+    mTruncatePath( worker, PATH_SIZE );
+}
+
+void Solver::mExpand( Worker& worker, Frame& frame ) {
+    frame.amount = 0;
+    frame.next = 0;
+    mApplySafeMoves( frame.game, worker.path );
+    frame.pathSize = worker.path.size();
+
+    if( frame.game.isWon() ) {
+        // Only the first win is kept, as the others are just as valid
+        lock_guard<mutex> guard( mSolutionLock );
+        if( !mWon ) {
+            mWon = true;
+            mSolution = mGetPath( worker );
+        }
+
+        mStop();
+    } else if( !mStopped 
+        // A position that was already searched either failed to lead to a
+        // win, or is still being searched elsewhere. Either way, there is
+        // nothing to gain from searching it again
+        && mTable.insert( frame.game.getState().getHash() ) 
+        && mCountNode( worker ) ) {
+        int ratings[MAX_CANDIDATES];
+        frame.amount = mGetCandidates( frame.game, frame.moves, frame.turns );
+        for( unsigned int i = 0; i < frame.amount; ++i ) {
+            ratings[i] = mRate( frame.game, frame.moves[i] );
+        }
+
+        // Insertion sort the moves by descending rating. Move lists are
+        // short enough that this is faster than anything more elaborate,
+        // and it keeps waste moves that need fewer turns first
+        for( unsigned int i = 1; i < frame.amount; ++i ) {
+            for( unsigned int j = i; j > 0 && ratings[j] > ratings[j - 1]; --j ) {
+                swap( frame.moves[j], frame.moves[j - 1] );
+                swap( frame.turns[j], frame.turns[j - 1] );
+                swap( ratings[j], ratings[j - 1] );
+            }
+        }
+
+        // Moves rated below zero are not searched. If any of them could
+        // still have led to a win, the search can no longer prove that
+        // the game cannot be won
+        unsigned int searchAmount = 0;
+        while( searchAmount < frame.amount && ratings[searchAmount] >= 0 ) {
+            ++searchAmount;
+        }
+
+        for( unsigned int i = searchAmount; i < frame.amount; ++i ) {
+            if( ratings[i] == PRUNED ) {
+                mPruned = true;
+            }
+        }
+
+        frame.amount = searchAmount;
+    }
+}
+
+void Solver::mStop() {
+    mStopped = true;
+    mWakeIdle();
+}
+
+void Solver::mWakeIdle() {
+    // A worker counts itself as idle before checking whether it can sleep,
+    // and whatever woke it changed first, so if no worker is idle yet, the
+    // next one to be will see the change on its own
+    if( mIdleWorkers == 0 ) {
+        return;
+    }
+
+    {
+        lock_guard<mutex> guard( mIdleLock );
+    }
+    mTasksChanged.notify_all();
+}
+
+bool Solver::mCountNode( Worker& worker ) {
+    if( mNodeLimit > 0 && mNodes + worker.nodes >= mNodeLimit ) {
+        mLimitReached = true;
+        mStop();
+        return false;
+    }
+
+    ++worker.nodes;
+    if( worker.nodes >= NODE_BATCH ) {
+        mFlushNodes( worker );
+    }
+
+    return true;
+}
+
+void Solver::mFlushNodes( Worker& worker ) {
+    mNodes += worker.nodes;
+    worker.nodes = 0;
+}
+
+void Solver::mShareMoves( 
+    Worker& worker, 
+    const Klondike& GAME, 
+    const Move* pMoves, 
+    const unsigned char* pTurns, 
+    const unsigned int AMOUNT 
+) {
+    mPendingTasks += AMOUNT;
+
+    // Each task only gets a node of its own for its move, following the
+    // path to the position, which is added to the shared tree once
+    unsigned int firstNode;
+    {
+        lock_guard<mutex> guard( mPathLock );
+        const unsigned int PARENT = mPublishPath( worker );
+        firstNode = mPathNodes.size();
+        for( unsigned int i = AMOUNT; i > 0; --i ) {
+            mPathNodes.push_back( PathNode { PARENT, pMoves[i - 1], pTurns[i - 1] } );
+        }
+    }
+
+    // Queue the most promising move last, so that it is the next one this
+    // worker takes if nobody steals it first
+    {
+        lock_guard<mutex> guard( worker.lock );
+        for( unsigned int i = AMOUNT; i > 0; --i ) {
+            Task task { GAME, firstNode + AMOUNT - i };
+            mApplyMove( task.game, pMoves[i - 1], pTurns[i - 1] );
+            worker.tasks.push_back( task );
+            ++mQueuedTasks;
+        }
+    }
+
+    mWakeIdle();
+}
+
+void Solver::mApplyMove( Klondike& game, const Move MOVE, const unsigned int TURNS ) const {
+    for( unsigned int i = 0; i < TURNS; ++i ) {
+        game.turnStock();
+    }
+
+    game.apply( MOVE );
+}
+
+void Solver::mAppendMove( vector<Move>& path, const Move MOVE, const unsigned int TURNS ) const {
+    for( unsigned int i = 0; i < TURNS; ++i ) {
+        path.push_back( Move { Pile::STOCK, Pile::WASTE, 1 } );
+    }
+
+    path.push_back( MOVE );
+}
+
+void Solver::mTruncatePath( Worker& worker, const unsigned int SIZE ) const {
+    // Moves past SIZE are about to be replaced, so their nodes no longer
+    // describe the path
+    worker.path.resize( SIZE );
+    if( worker.pathNodes.size() > SIZE ) {
+        worker.pathNodes.resize( SIZE );
+    }
+}
+
+unsigned int Solver::mPublishPath( Worker& worker ) {
+    unsigned int parent = worker.pathNodes.empty() ? worker.pathRoot : worker.pathNodes.back();
+    for( unsigned int i = worker.pathNodes.size(); i < worker.path.size(); ++i ) {
+        mPathNodes.push_back( PathNode { parent, worker.path[i], 0 } );
+        parent = mPathNodes.size() - 1;
+        worker.pathNodes.push_back( parent );
+    }
+
+    return parent;
+}
+
+vector<Move> Solver::mGetPath( const Worker& WORKER ) {
+    vector<Move> path;
+    lock_guard<mutex> guard( mPathLock );
+
+    // The tree only links each node to its parent, so the nodes are
+    // gathered from the last move back to the first
+    vector<unsigned int> nodes;
+    for( unsigned int i = WORKER.pathRoot; i != EMPTY_PATH; i = mPathNodes[i].parent ) {
+        nodes.push_back( i );
+    }
+
+    for( unsigned int i = nodes.size(); i > 0; --i ) {
+        const PathNode& NODE = mPathNodes[nodes[i - 1]];
+        mAppendMove( path, NODE.move, NODE.turns );
+    }
+
+    path.insert( path.end(), WORKER.path.begin(), WORKER.path.end() );
+    return path;
+}
+
+unsigned int Solver::mApplySafeMoves( Klondike& game, vector<Move>& path ) const {
+    unsigned int amount = 0;
+
+    // A card is safe to place on its foundation once every card of the
+    // opposite color that could be stacked on it is already on a
+    // foundation. Keep sweeping until no more cards can be placed.
+    bool moved = true;
+    while( moved ) {
+        moved = false;
+        for( unsigned int i = Pile::WASTE; i < Pile::PILE_AMOUNT; ++i ) {
+            const Pile FROM = (Pile) i;
+            const unsigned int SIZE = game.getSize( FROM );
+            if( ( FROM >= Pile::FOUNDATION && FROM < Pile::COLUMN ) || SIZE == 0 ) {
+                continue;
+            }
+
+            const Card TOP = game.getCard( FROM, SIZE - 1 );
+            const Pile TO = (Pile) (Pile::FOUNDATION + TOP.getSuit());
+
+            // Suits are organized by color, so the opposite color suits
+            // are the other half of the suits
+            const unsigned int OPPOSITE = (TOP.getSuit() < CardSuit::HEARTS) 
+                ? CardSuit::HEARTS 
+                : CardSuit::CLUBS;
+            const unsigned int LOWEST = min( 
+                game.getSize( (Pile) (Pile::FOUNDATION + OPPOSITE) ),
+                game.getSize( (Pile) (Pile::FOUNDATION + OPPOSITE + 1) ) 
+            );
+
+            const bool IS_SAFE = TOP.getRank() <= CardRank::TWO 
+                || (unsigned int) TOP.getRank() <= LOWEST;
+            if( IS_SAFE && game.move( FROM, 1, TO ) ) {
+                path.push_back( Move { 
+                    (unsigned char) FROM, 
+                    (unsigned char) TO, 
+                    1 
+                } );
+                ++amount;
+                moved = true;
+            }
+        }
+    }
+
+    return amount;
+}
+
+unsigned int Solver::mGetCandidates( 
+    const Klondike& GAME, 
+    Move* pMoves, 
+    unsigned char* pTurns 
+) const {
+    unsigned int amount = 0;
+
+    // Take every legal move other than those involving the deck
+    Move legalMoves[Klondike::MAX_MOVES];
+    const unsigned int LEGAL_AMOUNT = GAME.getLegalMoves( legalMoves, Klondike::MAX_MOVES );
+    for( unsigned int i = 0; i < LEGAL_AMOUNT; ++i ) {
+        if( legalMoves[i].from != Pile::STOCK && legalMoves[i].from != Pile::WASTE ) {
+            pMoves[amount] = legalMoves[i];
+            pTurns[amount] = 0;
+            ++amount;
+        }
+    }
+
+    // Turning through the whole deck, including the recycle, returns it
+    // to where it started. Every waste card that can be played along the
+    // way becomes a candidate, which is far cheaper than searching each
+    // turn of the stock as its own position. Turning only changes which
+    // card is on top of the waste, so that card is read straight from the
+    // piles rather than turning a copy of the game
+    const unsigned int STOCK_SIZE = GAME.getSize( Pile::STOCK );
+    const unsigned int WASTE_SIZE = GAME.getSize( Pile::WASTE );
+    const unsigned int CYCLE = STOCK_SIZE + WASTE_SIZE + 1;
+    for( unsigned int i = 0; i < CYCLE; ++i ) {
+        Card top;
+        if( i == 0 ) {
+            if( WASTE_SIZE == 0 ) {
+                continue;
+            }
+            top = GAME.getCard( Pile::WASTE, WASTE_SIZE - 1 );
+        } else if( i <= STOCK_SIZE ) {
+            // Each turn draws the top of the stock
+            top = GAME.getCard( Pile::STOCK, STOCK_SIZE - i );
+        } else if( i == STOCK_SIZE + 1 ) {
+            // The recycle leaves the waste empty
+            continue;
+        } else {
+            // After the recycle, the waste is drawn again from its bottom
+            top = GAME.getCard( Pile::WASTE, i - STOCK_SIZE - 2 );
+        }
+
+        const Pile FOUNDATION = (Pile) (Pile::FOUNDATION + top.getSuit());
+        if( GAME.canPut( top, 1, FOUNDATION ) ) {
+            pMoves[amount] = Move { Pile::WASTE, (unsigned char) FOUNDATION, 1 };
+            pTurns[amount] = i;
+            ++amount;
+        }
+
+        for( unsigned int j = 0; j < Column::AMOUNT; ++j ) {
+            const Pile COLUMN = (Pile) (Pile::COLUMN + j);
+            if( GAME.canPut( top, 1, COLUMN ) ) {
+                pMoves[amount] = Move { Pile::WASTE, (unsigned char) COLUMN, 1 };
+                pTurns[amount] = i;
+                ++amount;
+            }
+        }
+    }
+
+    return amount;
+}
+
+int Solver::mRate( const Klondike& GAME, const Move MOVE ) const {
+    const Pile FROM = (Pile) MOVE.from;
+    const Pile TO = (Pile) MOVE.to;
+
+    if( TO < Pile::COLUMN ) {
+        // Building a foundation is always progress
+        return 5;
+    }
+
+    if( FROM == Pile::WASTE ) {
+        return 3;
+    }
+
+    if( FROM < Pile::COLUMN ) {
+        // Taking cards back out of a foundation is rarely needed
+        return 0;
+    }
+
+    const unsigned int SIZE = GAME.getSize( FROM );
+    const unsigned int HIDDEN = GAME.getHiddenSize( FROM );
+    if( MOVE.count == SIZE - HIDDEN ) {
+        if( HIDDEN == 0 && GAME.getSize( TO ) == 0 ) {
+            // Moving a whole column into another empty column only
+            // swaps the two columns, which leaves a position that is no
+            // closer to or further from a win
+            return USELESS;
+        }
+
+        // Moving every shown card reveals a card or empties a column
+        return 4;
+    }
+
+    // Splitting a run rarely helps unless the card it uncovers can then
+    // be placed on its foundation
+    const Card UNCOVERED = GAME.getCard( FROM, SIZE - MOVE.count - 1 );
+    const Pile FOUNDATION = (Pile) (Pile::FOUNDATION + UNCOVERED.getSuit());
+    if( GAME.getSize( FOUNDATION ) != (unsigned int) UNCOVERED.getRank() ) {
+        return PRUNED;
+    }
+
+    return 1;
+}
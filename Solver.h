@@ -0,0 +1,350 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the solver, which searches a deal for a winning sequence of
+ * moves.
+ */
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <cstdint>
+
+#include "Klondike.h"
+#include "Move.h"
+#include "ShardedTranspositionTable.h"
+#include "SolverResult.h"
+
+/**
+ * @brief A depth-first search for a winning sequence of moves in a game.
+ * Every position that has been searched is kept in a transposition table
+ * keyed by its hash, so positions reached through different move orders
+ * are only ever searched once. Stock turns are not searched one at a time,
+ * but as a single step to every waste card that can then be played.
+ *
+ * The search can be split across several threads. Each thread searches
+ * depth-first on its own, and whenever another thread runs out of work,
+ * it hands the unsearched moves of its current position over as tasks
+ * that idle threads steal. Threads without work sleep until a task is
+ * handed over. Tasks do not copy the moves leading to them, but refer to
+ * a shared tree of moves that every task from the same position extends.
+ * All threads share one transposition table, and stop as soon as any of
+ * them finds a win
+ */
+class Solver final {
+public:
+    /**
+     * @brief Create a solver that searches on the calling thread
+     * @param NODE_LIMIT The most positions that will be searched before
+     * giving up on a game, or 0 for no limit
+     */
+    Solver( const unsigned long NODE_LIMIT );
+
+    /**
+     * @brief Create a solver
+     * @param NODE_LIMIT The most positions that will be searched before
+     * giving up on a game, or 0 for no limit
+     * @param THREAD_AMOUNT The amount of threads to search with, including
+     * the calling thread
+     */
+    Solver( const unsigned long NODE_LIMIT, const unsigned int THREAD_AMOUNT );
+
+    /**
+     * @brief Search a game for a win
+     * @param GAME The game to search from its current position
+     * @return WINNABLE if a win was found, UNWINNABLE if every reachable
+     * position was searched without a win, or UNDECIDED if the node limit
+     * was reached first or moves that might have won were left unsearched
+     */
+    SolverResult solve( const Klondike& GAME );
+
+    /**
+     * @brief Get the winning moves found by the last search
+     * @return The moves to apply in order to win the game, or an empty list
+     * if the last search did not find a win
+     */
+    const std::vector<Move>& getSolution() const;
+
+    /**
+     * @brief Get the amount of positions expanded by the last search
+     * @return The node count
+     */
+    unsigned long getNodeCount() const;
+
+private:
+    /**
+     * @brief The most moves that can be searched from a position. These are
+     * the legal moves, plus a waste move to the foundation or any column for
+     * every card that can be turned onto the waste
+     */
+    static const unsigned int MAX_CANDIDATES = Klondike::MAX_MOVES 
+        + Card::AMOUNT * (1 + Column::AMOUNT);
+
+    /**
+     * @brief The amount of nodes a thread counts on its own before adding
+     * them to the shared node count
+     */
+    static const unsigned long NODE_BATCH = 1024;
+
+    /**
+     * @brief The rating of a move that can never bring a win any closer,
+     * which is never searched
+     */
+    static const int USELESS = -1;
+
+    /**
+     * @brief The rating of a move that is unlikely to help, which is not
+     * searched, but keeps a search that fails from proving the game cannot
+     * be won
+     */
+    static const int PRUNED = -2;
+
+    /**
+     * @brief The path node of a position that was reached without any moves
+     */
+    static const unsigned int EMPTY_PATH = ~0u;
+
+    /**
+     * @brief A move in the shared tree of moves leading to tasks, which
+     * follows the moves of its parent node
+     */
+    struct PathNode {
+        unsigned int parent;
+        Move move;
+        unsigned char turns;
+    };
+
+    /**
+     * @brief A position that is still to be searched, along with the path
+     * node of the last move leading to it
+     */
+    struct Task {
+        Klondike game;
+        unsigned int pathNode;
+    };
+
+    /**
+     * @brief A position on the search stack of a thread, along with the
+     * moves that are still to be searched from it
+     */
+    struct Frame {
+        Klondike game;
+        Move moves[MAX_CANDIDATES];
+        unsigned char turns[MAX_CANDIDATES];
+        unsigned int amount;
+        unsigned int next;
+        unsigned int pathSize;
+    };
+
+    /**
+     * @brief The state of one searching thread. Its path holds the moves
+     * made since the position of its current task, and the first of them
+     * may already be in the shared tree, as the nodes in pathNodes
+     */
+    struct Worker {
+        std::mutex lock;
+        std::deque<Task> tasks;
+        unsigned int pathRoot;
+        std::vector<Move> path;
+        std::vector<unsigned int> pathNodes;
+        std::vector<Frame> frames;
+        unsigned long nodes;
+    };
+
+    unsigned long mNodeLimit;
+    ShardedTranspositionTable mTable;
+    std::vector<Worker> mWorkers;
+
+    std::atomic<unsigned long> mNodes;
+    std::atomic<unsigned long> mPendingTasks;
+    std::atomic<unsigned long> mQueuedTasks;
+    std::atomic<unsigned int> mIdleWorkers;
+    std::atomic<bool> mStopped;
+    std::atomic<bool> mLimitReached;
+    std::atomic<bool> mPruned;
+
+    std::mutex mIdleLock;
+    std::condition_variable mTasksChanged;
+
+    std::mutex mPathLock;
+    std::vector<PathNode> mPathNodes;
+
+    std::mutex mSolutionLock;
+    bool mWon;
+    std::vector<Move> mSolution;
+
+    /**
+     * @brief Run tasks on one thread until the search is over
+     * @param NUMBER The index of the worker to run as
+     */
+    void mWork( const unsigned int NUMBER );
+
+    /**
+     * @brief Take a task from a worker's own queue, or failing that, from
+     * the queue of any other worker
+     * @param NUMBER The index of the worker taking the task
+     * @param task The task to write to
+     * @return true if a task was taken, false if every queue was empty
+     */
+    bool mTakeTask( const unsigned int NUMBER, Task& task );
+
+    /**
+     * @brief Search a position and all positions reachable from it, unless
+     * the search is stopped first. If a win is found, the path of the
+     * worker leading to it becomes the solution
+     * @param worker The worker searching, whose path leads to the position
+     * @param GAME The position to search
+     */
+    void mSearch( Worker& worker, const Klondike& GAME );
+
+    /**
+     * @brief Start searching the position of a frame by playing its safe
+     * moves and listing the moves to search from it, most promising first.
+     * No moves are listed if the position is a win, was already searched,
+     * or the search is over
+     * @param worker The worker searching, whose path leads to the position
+     * @param frame The frame holding the position to search
+     */
+    void mExpand( Worker& worker, Frame& frame );
+
+    /**
+     * @brief Stop the search on every thread
+     */
+    void mStop();
+
+    /**
+     * @brief Wake every idle worker, so that it can check for new tasks or
+     * for the end of the search
+     */
+    void mWakeIdle();
+
+    /**
+     * @brief Count a searched node against the node limit
+     * @param worker The worker that searched the node
+     * @return true if the node can be searched, false if the limit has
+     * been reached
+     */
+    bool mCountNode( Worker& worker );
+
+    /**
+     * @brief Add the nodes a worker has counted on its own to the shared
+     * node count
+     * @param worker The worker to flush
+     */
+    void mFlushNodes( Worker& worker );
+
+    /**
+     * @brief Hand moves of a position over to other workers as tasks
+     * @param worker The worker searching the position
+     * @param GAME The position the moves are made from
+     * @param pMoves The moves to hand over
+     * @param pTurns The amount of stock turns to make before each move
+     * @param AMOUNT The amount of moves to hand over
+     */
+    void mShareMoves( 
+        Worker& worker, 
+        const Klondike& GAME, 
+        const Move* pMoves, 
+        const unsigned char* pTurns, 
+        const unsigned int AMOUNT 
+    );
+
+    /**
+     * @brief Apply a searched move, including the stock turns before it, to
+     * a position
+     * @param game The position to apply the move to
+     * @param MOVE The move to apply
+     * @param TURNS The amount of stock turns to make first
+     */
+    void mApplyMove( Klondike& game, const Move MOVE, const unsigned int TURNS ) const;
+
+    /**
+     * @brief Append a searched move, including the stock turns before it, to
+     * a path
+     * @param path The path to append the moves to
+     * @param MOVE The move to append
+     * @param TURNS The amount of stock turns to append first
+     */
+    void mAppendMove( std::vector<Move>& path, const Move MOVE, const unsigned int TURNS ) const;
+
+    /**
+     * @brief Shorten the path of a worker, forgetting the shared nodes of
+     * any moves that are removed
+     * @param worker The worker whose path to shorten
+     * @param SIZE The amount of moves to keep
+     */
+    void mTruncatePath( Worker& worker, const unsigned int SIZE ) const;
+
+    /**
+     * @brief Add the moves of a worker's path that are not in the shared
+     * tree yet to it. This must be called while holding mPathLock
+     * @param worker The worker whose path to add
+     * @return The path node of the last move of the path
+     */
+    unsigned int mPublishPath( Worker& worker );
+
+    /**
+     * @brief Get every move leading to the current position of a worker,
+     * including those leading to its task
+     * @param WORKER The worker
+     * @return The moves from the start of the search
+     */
+    std::vector<Move> mGetPath( const Worker& WORKER );
+
+    /**
+     * @brief Apply every foundation move that can never be needed back in
+     * the columns, which are played without branching
+     * @param game The game to apply the moves to
+     * @param path The path to append the applied moves to
+     * @return The amount of moves applied
+     */
+    unsigned int mApplySafeMoves( Klondike& game, std::vector<Move>& path ) const;
+
+    /**
+     * @brief List the moves to search from a position
+     * @param GAME The position to search
+     * @param pMoves The buffer to write the moves to, which must fit
+     * MAX_CANDIDATES moves
+     * @param pTurns The buffer to write the amount of stock turns that
+     * must be made before each move to
+     * @return The amount of moves written
+     */
+    unsigned int mGetCandidates( 
+        const Klondike& GAME, 
+        Move* pMoves, 
+        unsigned char* pTurns 
+    ) const;
+
+    /**
+     * @brief Rate how promising a move is, so that the most promising moves
+     * can be searched first
+     * @param GAME The position the move would be applied to
+     * @param MOVE The move to rate
+     * @return A priority, where higher values are searched first, or
+     * USELESS or PRUNED if the move is not searched at all
+     */
+    int mRate( const Klondike& GAME, const Move MOVE ) const;
+};
+
+#endif
@@ -23,6 +23,8 @@
 #ifndef STATISTICS_H
 #define STATISTICS_H
 
+#include "QuantileSketch.h"
+
 /**
  * @brief A set of game statistics derived from the game history
  */
@@ -71,6 +73,26 @@ struct Statistics {
      * @brief The smallest amount of moves it took to win a game
      */
     unsigned int smallestWinMoves;
+
+    /**
+     * @brief The distribution of the time it took to win games, in seconds
+     */
+    QuantileSketch winDurations;
+
+    /**
+     * @brief The distribution of the amount of moves made in won games
+     */
+    QuantileSketch winMoves;
+
+    /**
+     * @brief The distribution of the time spent on lost games, in seconds
+     */
+    QuantileSketch lossDurations;
+
+    /**
+     * @brief The distribution of the amount of moves made in lost games
+     */
+    QuantileSketch lossMoves;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,85 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the Statistics Snapshot data structure, which is how the
+ * statistics of the history are stored between runs.
+ */
+
+#include "StatisticsSnapshot.h"
+
+#include <cstddef>
+#include <cstring>
+
+#include "Checksum.h"
+
+// Statistics files start with this
+static const char MAGIC[4] = { 'S', 'L', 'S', 'T' };
+
+static const uint32_t VERSION = 3;
+
+StatisticsSnapshot StatisticsSnapshot::fromStatistics( 
+    const Statistics STATISTICS, 
+    const uint64_t RECORD_COUNT, 
+    const uint32_t LAST_CHECKSUM,
+    const uint32_t DAY_COUNT 
+) {
+    StatisticsSnapshot snapshot;
+    memcpy( snapshot.magic, MAGIC, sizeof( MAGIC ) );
+    snapshot.version = VERSION;
+    snapshot.recordCount = RECORD_COUNT;
+    snapshot.lastChecksum = LAST_CHECKSUM;
+    snapshot.totalGames = STATISTICS.totalGames;
+    snapshot.wins = STATISTICS.wins;
+    snapshot.currentStreakLength = STATISTICS.currentStreakLength;
+    snapshot.longestWinningStreak = STATISTICS.longestWinningStreak;
+    snapshot.longestLosingStreak = STATISTICS.longestLosingStreak;
+    snapshot.shortestWinDuration = STATISTICS.shortestWinDuration;
+    snapshot.smallestWinMoves = STATISTICS.smallestWinMoves;
+    snapshot.isOnWinningStreak = STATISTICS.isOnWinningStreak ? 1 : 0;
+    memset( snapshot.reserved, 0, sizeof( snapshot.reserved ) );
+    snapshot.dayCount = DAY_COUNT;
+    snapshot.winDurations = STATISTICS.winDurations;
+    snapshot.winMoves = STATISTICS.winMoves;
+    snapshot.lossDurations = STATISTICS.lossDurations;
+    snapshot.lossMoves = STATISTICS.lossMoves;
+    snapshot.checksum = computeChecksum( &snapshot, offsetof( StatisticsSnapshot, checksum ) );
+    return snapshot;
+}
+
+Statistics StatisticsSnapshot::toStatistics() const {
+    Statistics statistics;
+    statistics.totalGames = totalGames;
+    statistics.wins = wins;
+    statistics.isOnWinningStreak = isOnWinningStreak != 0;
+    statistics.currentStreakLength = currentStreakLength;
+    statistics.longestWinningStreak = longestWinningStreak;
+    statistics.longestLosingStreak = longestLosingStreak;
+    statistics.shortestWinDuration = shortestWinDuration;
+    statistics.smallestWinMoves = smallestWinMoves;
+    statistics.winDurations = winDurations;
+    statistics.winMoves = winMoves;
+    statistics.lossDurations = lossDurations;
+    statistics.lossMoves = lossMoves;
+    return statistics;
+}
+
+bool StatisticsSnapshot::isValid() const {
+    return memcmp( magic, MAGIC, sizeof( MAGIC ) ) == 0
+        && version == VERSION
+        && checksum == computeChecksum( this, offsetof( StatisticsSnapshot, checksum ) );
+}
@@ -0,0 +1,124 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the Statistics Snapshot data structure, which is how the
+ * statistics of the history are stored between runs.
+ */
+
+#ifndef STATISTICS_SNAPSHOT_H
+#define STATISTICS_SNAPSHOT_H
+
+#include <cstdint>
+
+#include "QuantileSketch.h"
+#include "Statistics.h"
+
+/**
+ * @brief The statistics of the first games of the history, as stored in the
+ * statistics file, so that only the games after them have to be read to
+ * bring the statistics up to date. It is followed by the days of the
+ * history index, and then the checksum of those days. It is only a cache
+ * of the history, and is simply recalculated whenever it is missing,
+ * damaged, or does not match the history file
+ */
+struct StatisticsSnapshot {
+    /**
+     * @brief Always "SLST", which identifies statistics files
+     */
+    char magic[4];
+
+    /**
+     * @brief The version of the format of the file
+     */
+    uint32_t version;
+
+    /**
+     * @brief The amount of history records that the statistics cover
+     */
+    uint64_t recordCount;
+
+    /**
+     * @brief The checksum of the last record that the statistics cover,
+     * which tells whether the history file is still the one they were
+     * calculated from
+     */
+    uint32_t lastChecksum;
+
+    // The statistics themselves, each as described in Statistics. The
+    // longest streaks may not include the current streak yet
+    uint32_t totalGames;
+    uint32_t wins;
+    uint32_t currentStreakLength;
+    uint32_t longestWinningStreak;
+    uint32_t longestLosingStreak;
+    int64_t shortestWinDuration;
+    uint32_t smallestWinMoves;
+    uint8_t isOnWinningStreak;
+
+    /**
+     * @brief Unused space, always written as zero
+     */
+    uint8_t reserved[3];
+
+    /**
+     * @brief The amount of days of the history index after the snapshot
+     */
+    uint32_t dayCount;
+
+    // The distributions of the games, as described in Statistics
+    QuantileSketch winDurations;
+    QuantileSketch winMoves;
+    QuantileSketch lossDurations;
+    QuantileSketch lossMoves;
+
+    /**
+     * @brief The checksum of every other field of the snapshot
+     */
+    uint32_t checksum;
+
+    /**
+     * @brief Create a snapshot of some statistics, including its checksum
+     * @param STATISTICS The statistics to store
+     * @param RECORD_COUNT The amount of records the statistics cover
+     * @param LAST_CHECKSUM The checksum of the last of those records
+     * @param DAY_COUNT The amount of days of the history index
+     * @return A snapshot holding the same statistics
+     */
+    static StatisticsSnapshot fromStatistics( 
+        const Statistics STATISTICS, 
+        const uint64_t RECORD_COUNT, 
+        const uint32_t LAST_CHECKSUM,
+        const uint32_t DAY_COUNT 
+    );
+
+    /**
+     * @brief Get the statistics stored in the snapshot
+     * @return The stored statistics
+     */
+    Statistics toStatistics() const;
+
+    /**
+     * @brief Check if the snapshot was written completely
+     * @return true if the checksum matches the snapshot, false otherwise
+     */
+    bool isValid() const;
+};
+
+static_assert( sizeof( StatisticsSnapshot ) == 64 + 4 * sizeof( QuantileSketch ), "Statistics snapshots must not have padding" );
+
+#endif
@@ -0,0 +1,404 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the Statistics Summary data structure, which allows the
+ * statistics of a history to be calculated in separate parts.
+ */
+
+#include "StatisticsSummary.h"
+
+using namespace std;
+
+#include <algorithm>
+#include <bitset>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+// Starting a thread costs more than summarizing a few records, so each
+// thread is given at least this many. "make bench" measures starting a
+// thread at about 20 us and a record at about 45 ns, so a thread with
+// this many records spends well under a tenth of its time starting up
+static const unsigned long MIN_RECORDS_PER_THREAD = 8192;
+
+/**
+ * @brief Count a run of games with the same result towards the streaks and
+ * game count of a summary, as if each game had been added in turn
+ * @param summary The summary to add the run to
+ * @param IS_WIN Whether the games of the run were won
+ * @param LENGTH The amount of games in the run
+ */
+static void addRun( StatisticsSummary& summary, const bool IS_WIN, const unsigned int LENGTH ) {
+    if( summary.games == 0 ) {
+        summary.isFirstWin = IS_WIN;
+    }
+
+    if( summary.firstStreakLength == summary.games && IS_WIN == summary.isFirstWin ) {
+        summary.firstStreakLength += LENGTH;
+    }
+
+    if( summary.games > 0 && IS_WIN == summary.isLastWin ) {
+        summary.lastStreakLength += LENGTH;
+    } else {
+        summary.isLastWin = IS_WIN;
+        summary.lastStreakLength = LENGTH;
+    }
+
+    if( IS_WIN && summary.lastStreakLength > summary.longestWinningStreak ) {
+        summary.longestWinningStreak = summary.lastStreakLength;
+    } else if( !IS_WIN && summary.lastStreakLength > summary.longestLosingStreak ) {
+        summary.longestLosingStreak = summary.lastStreakLength;
+    }
+
+    summary.games += LENGTH;
+}
+
+/**
+ * @brief Where the games being summarized are kept, which is either
+ * history records or games held in memory
+ */
+struct GameSource {
+    const HistoryRecord* pRecords;
+    const HistoryColumns* pColumns;
+};
+
+/**
+ * @brief Summarize a range of games into a given summary, so that it can
+ * be run on a thread
+ * @param SOURCE The games to summarize
+ * @param BEGIN The position of the first game to summarize
+ * @param END The position after the last game to summarize
+ * @param pSummary The destination summary
+ */
+static void summarize( 
+    const GameSource SOURCE, 
+    const unsigned long BEGIN, 
+    const unsigned long END, 
+    StatisticsSummary* pSummary 
+) {
+    if( SOURCE.pColumns != nullptr ) {
+        *pSummary = StatisticsSummary::fromColumns( *SOURCE.pColumns, BEGIN, END );
+    } else {
+        *pSummary = StatisticsSummary::fromRecords( SOURCE.pRecords + BEGIN, END - BEGIN );
+    }
+}
+
+/**
+ * @brief Summarize games, splitting them between several threads
+ * @param SOURCE The games to summarize
+ * @param COUNT The amount of games
+ * @param THREAD_AMOUNT The most threads to summarize with, including the
+ * calling thread
+ * @return The summary of every game
+ */
+static StatisticsSummary summarizeInParts( 
+    const GameSource SOURCE, 
+    const unsigned long COUNT, 
+    const unsigned int THREAD_AMOUNT 
+) {
+    unsigned long partAmount = COUNT / MIN_RECORDS_PER_THREAD;
+    if( partAmount > THREAD_AMOUNT ) {
+        partAmount = THREAD_AMOUNT;
+    }
+
+    if( partAmount <= 1 ) {
+        StatisticsSummary summary;
+        summarize( SOURCE, 0, COUNT, &summary );
+        return summary;
+    }
+
+    // Each part is summarized on its own thread, and the calling thread
+    // takes the first part instead of waiting
+    vector<StatisticsSummary> summaries( partAmount );
+    vector<thread> threads;
+    for( unsigned long i = 1; i < partAmount; ++i ) {
+        const unsigned long BEGIN = COUNT * i / partAmount;
+        const unsigned long END = COUNT * (i + 1) / partAmount;
+        threads.push_back( thread( summarize, SOURCE, BEGIN, END, &summaries[i] ) );
+    }
+
+    summarize( SOURCE, 0, COUNT / partAmount, &summaries[0] );
+
+    for( thread& t : threads ) {
+        t.join();
+    }
+
+    // Summaries are only combined in the order of their games, as the
+    // streaks depend on it
+    for( unsigned long i = 1; i < partAmount; ++i ) {
+        summaries[0].append( summaries[i] );
+    }
+
+    return summaries[0];
+}
+
+StatisticsSummary StatisticsSummary::fromRecords( const HistoryRecord* pRecords, const unsigned long COUNT ) {
+    StatisticsSummary summary = StatisticsSummary();
+    for( unsigned long i = 0; i < COUNT; ++i ) {
+        summary.add( pRecords[i].toInfo() );
+    }
+
+    return summary;
+}
+
+StatisticsSummary StatisticsSummary::fromRecords( 
+    const HistoryRecord* pRecords, 
+    const unsigned long COUNT, 
+    const unsigned int THREAD_AMOUNT 
+) {
+    return summarizeInParts( GameSource { pRecords, nullptr }, COUNT, THREAD_AMOUNT );
+}
+
+StatisticsSummary StatisticsSummary::fromColumns( 
+    const HistoryColumns& GAMES, 
+    const unsigned long BEGIN, 
+    const unsigned long END 
+) {
+    StatisticsSummary summary = StatisticsSummary();
+    const uint64_t* P_WINS = GAMES.getWins();
+    const uint32_t* P_MOVES = GAMES.getMoves();
+    const int64_t* P_START_TIMES = GAMES.getStartTimes();
+    const int64_t* P_END_TIMES = GAMES.getEndTimes();
+
+    for( unsigned long word = BEGIN / HistoryColumns::WINS_PER_WORD; 
+         word * HistoryColumns::WINS_PER_WORD < END; 
+         ++word ) {
+        // The range may start or end partway through a word of wins
+        const unsigned long WORD_BEGIN = word * HistoryColumns::WINS_PER_WORD;
+        const unsigned int FIRST = BEGIN > WORD_BEGIN ? BEGIN - WORD_BEGIN : 0;
+        const unsigned int LAST = min( END - WORD_BEGIN, (unsigned long) HistoryColumns::WINS_PER_WORD );
+        const uint64_t RANGE = (LAST - FIRST == 64) 
+            ? ~(uint64_t) 0 
+            : (((uint64_t) 1 << (LAST - FIRST)) - 1) << FIRST;
+        const uint64_t WINS = P_WINS[word] & RANGE;
+        const uint32_t* P_WORD_MOVES = P_MOVES + WORD_BEGIN;
+        const int64_t* P_WORD_START_TIMES = P_START_TIMES + WORD_BEGIN;
+        const int64_t* P_WORD_END_TIMES = P_END_TIMES + WORD_BEGIN;
+
+        // Losses are given the largest value instead of being skipped, so
+        // that the minimums are taken without branching
+        uint32_t smallestMoves = UINT32_MAX;
+        int64_t shortestDuration = INT64_MAX;
+        for( unsigned int i = FIRST; i < LAST; ++i ) {
+            const bool IS_WIN = (WINS >> i) & 1;
+            const int64_t DURATION = P_WORD_END_TIMES[i] - P_WORD_START_TIMES[i];
+            smallestMoves = min( smallestMoves, IS_WIN ? P_WORD_MOVES[i] : UINT32_MAX );
+            shortestDuration = min( shortestDuration, IS_WIN ? DURATION : INT64_MAX );
+        }
+
+        const unsigned int WORD_WINS = bitset<64>( WINS ).count();
+        if( WORD_WINS > 0 ) {
+            if( summary.wins == 0 || smallestMoves < summary.smallestWinMoves ) {
+                summary.smallestWinMoves = smallestMoves;
+            }
+
+            if( summary.wins == 0 || shortestDuration < summary.shortestWinDuration ) {
+                summary.shortestWinDuration = shortestDuration;
+            }
+        }
+
+        summary.wins += WORD_WINS;
+
+        for( unsigned int i = FIRST; i < LAST; ++i ) {
+            const int64_t DURATION = P_WORD_END_TIMES[i] - P_WORD_START_TIMES[i];
+            if( (WINS >> i) & 1 ) {
+                summary.winDurations.add( DURATION );
+                summary.winMoves.add( P_WORD_MOVES[i] );
+            } else {
+                summary.lossDurations.add( DURATION );
+                summary.lossMoves.add( P_WORD_MOVES[i] );
+            }
+        }
+
+        // Streaks are taken a whole run of wins or losses at a time. The
+        // length of a run is the amount of trailing ones of the remaining
+        // bits, or of their inverse for a run of losses
+        unsigned int i = FIRST;
+        while( i < LAST ) {
+            const bool IS_WIN = (WINS >> i) & 1;
+            const uint64_t RUN = IS_WIN ? WINS >> i : ~(WINS >> i);
+            const unsigned int LENGTH = min( 
+                (unsigned int) bitset<64>( (~RUN & (RUN + 1)) - 1 ).count(), 
+                LAST - i 
+            );
+
+            addRun( summary, IS_WIN, LENGTH );
+            i += LENGTH;
+        }
+    }
+
+    return summary;
+}
+
+StatisticsSummary StatisticsSummary::fromColumns( const HistoryColumns& GAMES, const unsigned int THREAD_AMOUNT ) {
+    return summarizeInParts( GameSource { nullptr, &GAMES }, GAMES.getSize(), THREAD_AMOUNT );
+}
+
+StatisticsSummary StatisticsSummary::fromStatistics( const Statistics STATISTICS ) {
+    StatisticsSummary summary = StatisticsSummary();
+    summary.games = STATISTICS.totalGames;
+    summary.wins = STATISTICS.wins;
+    summary.isLastWin = STATISTICS.isOnWinningStreak;
+    summary.lastStreakLength = STATISTICS.currentStreakLength;
+    summary.longestWinningStreak = STATISTICS.longestWinningStreak;
+    summary.longestLosingStreak = STATISTICS.longestLosingStreak;
+    summary.shortestWinDuration = STATISTICS.shortestWinDuration;
+    summary.smallestWinMoves = STATISTICS.smallestWinMoves;
+    summary.winDurations = STATISTICS.winDurations;
+    summary.winMoves = STATISTICS.winMoves;
+    summary.lossDurations = STATISTICS.lossDurations;
+    summary.lossMoves = STATISTICS.lossMoves;
+
+    // The longest streaks of a summary always include the streaks at its
+    // ends, which only matters for the current streak here
+    if( summary.isLastWin && summary.lastStreakLength > summary.longestWinningStreak ) {
+        summary.longestWinningStreak = summary.lastStreakLength;
+    } else if( !summary.isLastWin && summary.lastStreakLength > summary.longestLosingStreak ) {
+        summary.longestLosingStreak = summary.lastStreakLength;
+    }
+
+    // The first streak is only known when every game is part of it
+    if( summary.lastStreakLength == summary.games ) {
+        summary.isFirstWin = summary.isLastWin;
+        summary.firstStreakLength = summary.games;
+    }
+
+    return summary;
+}
+
+void StatisticsSummary::add( const SolitaireInfo INFO ) {
+    if( games == 0 ) {
+        isFirstWin = INFO.win;
+    }
+
+    if( firstStreakLength == games && INFO.win == isFirstWin ) {
+        // Every game so far is part of the first streak
+        ++firstStreakLength;
+    }
+
+    if( games > 0 && INFO.win == isLastWin ) {
+        ++lastStreakLength;
+    } else {
+        isLastWin = INFO.win;
+        lastStreakLength = 1;
+    }
+
+    if( INFO.win ) {
+        if( lastStreakLength > longestWinningStreak ) {
+            longestWinningStreak = lastStreakLength;
+        }
+
+        if( wins == 0 || INFO.getDuration() < shortestWinDuration ) {
+            shortestWinDuration = INFO.getDuration();
+        }
+
+        if( wins == 0 || INFO.moves < smallestWinMoves ) {
+            smallestWinMoves = INFO.moves;
+        }
+
+        winDurations.add( INFO.getDuration() );
+        winMoves.add( INFO.moves );
+        ++wins;
+    } else {
+        if( lastStreakLength > longestLosingStreak ) {
+            longestLosingStreak = lastStreakLength;
+        }
+
+        lossDurations.add( INFO.getDuration() );
+        lossMoves.add( INFO.moves );
+    }
+
+    ++games;
+}
+
+void StatisticsSummary::append( const StatisticsSummary& LATER ) {
+    if( LATER.games == 0 ) {
+        return;
+    }
+
+    if( games == 0 ) {
+        *this = LATER;
+        return;
+    }
+
+    if( isLastWin == LATER.isFirstWin ) {
+        // The streaks where the two summaries meet are one streak
+        const unsigned int JOINED_LENGTH = lastStreakLength + LATER.firstStreakLength;
+        if( isLastWin && JOINED_LENGTH > longestWinningStreak ) {
+            longestWinningStreak = JOINED_LENGTH;
+        } else if( !isLastWin && JOINED_LENGTH > longestLosingStreak ) {
+            longestLosingStreak = JOINED_LENGTH;
+        }
+    }
+
+    if( LATER.longestWinningStreak > longestWinningStreak ) {
+        longestWinningStreak = LATER.longestWinningStreak;
+    }
+
+    if( LATER.longestLosingStreak > longestLosingStreak ) {
+        longestLosingStreak = LATER.longestLosingStreak;
+    }
+
+    // A summary that is a single streak extends the streak next to it
+    if( firstStreakLength == games && isFirstWin == LATER.isFirstWin ) {
+        firstStreakLength += LATER.firstStreakLength;
+    }
+
+    if( LATER.lastStreakLength == LATER.games && isLastWin == LATER.isLastWin ) {
+        lastStreakLength += LATER.games;
+    } else {
+        isLastWin = LATER.isLastWin;
+        lastStreakLength = LATER.lastStreakLength;
+    }
+
+    if( LATER.wins > 0 ) {
+        if( wins == 0 || LATER.shortestWinDuration < shortestWinDuration ) {
+            shortestWinDuration = LATER.shortestWinDuration;
+        }
+
+        if( wins == 0 || LATER.smallestWinMoves < smallestWinMoves ) {
+            smallestWinMoves = LATER.smallestWinMoves;
+        }
+    }
+
+    winDurations.merge( LATER.winDurations );
+    winMoves.merge( LATER.winMoves );
+    lossDurations.merge( LATER.lossDurations );
+    lossMoves.merge( LATER.lossMoves );
+
+    games += LATER.games;
+    wins += LATER.wins;
+}
+
+Statistics StatisticsSummary::toStatistics() const {
+    Statistics statistics;
+    statistics.totalGames = games;
+    statistics.wins = wins;
+    statistics.isOnWinningStreak = games > 0 && isLastWin;
+    statistics.currentStreakLength = lastStreakLength;
+    statistics.longestWinningStreak = longestWinningStreak;
+    statistics.longestLosingStreak = longestLosingStreak;
+    statistics.shortestWinDuration = shortestWinDuration;
+    statistics.smallestWinMoves = smallestWinMoves;
+    statistics.winDurations = winDurations;
+    statistics.winMoves = winMoves;
+    statistics.lossDurations = lossDurations;
+    statistics.lossMoves = lossMoves;
+    return statistics;
+}
@@ -0,0 +1,178 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the Statistics Summary data structure, which allows the statistics
+ * of a history to be calculated in separate parts.
+ */
+
+#ifndef STATISTICS_SUMMARY_H
+#define STATISTICS_SUMMARY_H
+
+#include "HistoryColumns.h"
+#include "HistoryRecord.h"
+#include "QuantileSketch.h"
+#include "SolitaireInfo.h"
+#include "Statistics.h"
+
+/**
+ * @brief The statistics of a consecutive run of games, along with the
+ * streaks at either end of it. The summaries of two neighbouring runs of
+ * games can be combined into the summary of both, regardless of how the
+ * games were split between them, so a history can be summarized in
+ * separate parts at the same time and then combined in order
+ */
+struct StatisticsSummary {
+    /**
+     * @brief The amount of games summarized
+     */
+    unsigned int games;
+
+    /**
+     * @brief The amount of those games that were won
+     */
+    unsigned int wins;
+
+    /**
+     * @brief If the first game was won
+     */
+    bool isFirstWin;
+
+    /**
+     * @brief The length of the streak that the first game is part of
+     */
+    unsigned int firstStreakLength;
+
+    /**
+     * @brief If the last game was won
+     */
+    bool isLastWin;
+
+    /**
+     * @brief The length of the streak that the last game is part of
+     */
+    unsigned int lastStreakLength;
+
+    /**
+     * @brief The longest winning streak, including those at either end
+     */
+    unsigned int longestWinningStreak;
+
+    /**
+     * @brief The longest losing streak, including those at either end
+     */
+    unsigned int longestLosingStreak;
+
+    /**
+     * @brief The shortest time it took to win a game, in seconds
+     */
+    long shortestWinDuration;
+
+    /**
+     * @brief The smallest amount of moves it took to win a game
+     */
+    unsigned int smallestWinMoves;
+
+    /**
+     * @brief The distributions of the durations and moves of won and lost
+     * games, as described in Statistics
+     */
+    QuantileSketch winDurations;
+    QuantileSketch winMoves;
+    QuantileSketch lossDurations;
+    QuantileSketch lossMoves;
+
+    /**
+     * @brief Summarize the games of some history records
+     * @param pRecords The records to summarize
+     * @param COUNT The amount of records
+     * @return The summary of every game in the records
+     */
+    static StatisticsSummary fromRecords( const HistoryRecord* pRecords, const unsigned long COUNT );
+
+    /**
+     * @brief Summarize the games of some history records, splitting them
+     * between several threads
+     * @param pRecords The records to summarize
+     * @param COUNT The amount of records
+     * @param THREAD_AMOUNT The most threads to summarize with, including
+     * the calling thread
+     * @return The summary of every game in the records, which is the same
+     * no matter how many threads were used
+     */
+    static StatisticsSummary fromRecords( 
+        const HistoryRecord* pRecords, 
+        const unsigned long COUNT, 
+        const unsigned int THREAD_AMOUNT 
+    );
+
+    /**
+     * @brief Summarize some of the games held in memory
+     * @param GAMES The games to summarize
+     * @param BEGIN The position of the first game to summarize
+     * @param END The position after the last game to summarize
+     * @return The summary of the games in the range
+     */
+    static StatisticsSummary fromColumns( 
+        const HistoryColumns& GAMES, 
+        const unsigned long BEGIN, 
+        const unsigned long END 
+    );
+
+    /**
+     * @brief Summarize every game held in memory, splitting them between
+     * several threads
+     * @param GAMES The games to summarize
+     * @param THREAD_AMOUNT The most threads to summarize with, including
+     * the calling thread
+     * @return The summary of every game, which is the same no matter how
+     * many threads were used
+     */
+    static StatisticsSummary fromColumns( const HistoryColumns& GAMES, const unsigned int THREAD_AMOUNT );
+
+    /**
+     * @brief Summarize games from their statistics alone, such as those of
+     * games that are no longer kept. The streak the first game was part of
+     * is not known, so the summary can only come first when combined
+     * @param STATISTICS The statistics of the games, where the longest
+     * streaks may not include the current streak yet
+     * @return The summary of the games
+     */
+    static StatisticsSummary fromStatistics( const Statistics STATISTICS );
+
+    /**
+     * @brief Add a game after every game in the summary
+     * @param INFO The game to add
+     */
+    void add( const SolitaireInfo INFO );
+
+    /**
+     * @brief Add the games of another summary after every game in this
+     * summary
+     * @param LATER The summary of the games that came after this one
+     */
+    void append( const StatisticsSummary& LATER );
+
+    /**
+     * @brief Get the statistics of the summarized games
+     * @return The statistics, with the longest streaks including the
+     * current streak
+     */
+    Statistics toStatistics() const;
+};
+
+#endif
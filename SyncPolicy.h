@@ -0,0 +1,49 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the Sync Policy enum, which decides when appended data is forced
+ * out to disk.
+ */
+
+#ifndef SYNC_POLICY_H
+#define SYNC_POLICY_H
+
+/**
+ * @brief When data appended to a file is forced out to the disk, trading
+ * the cost of each write against how much may be lost in a power failure
+ */
+enum SyncPolicy {
+    /**
+     * @brief Leave it to the system, which survives the process being
+     * killed but not the machine losing power
+     */
+    NEVER = 0,
+
+    /**
+     * @brief Sync once when the file is closed
+     */
+    ON_CLOSE = 1,
+
+    /**
+     * @brief Sync after every append, so that nothing is ever lost once
+     * it has been written
+     */
+    EVERY_APPEND = 2
+};
+
+#endif
@@ -0,0 +1,87 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the functionality of the transposition table, which records which positions have
+ * already been searched.
+ */
+
+#include "TranspositionTable.h"
+
+using namespace std;
+
+#include <algorithm>
+
+// A slot of zero is empty, so a hash of zero is stored as one instead.
+// This merges the two positions, which is as likely as any other collision.
+
+TranspositionTable::TranspositionTable() {
+    mSize = 0;
+}
+
+bool TranspositionTable::insert( const uint64_t HASH ) {
+    // Keep the table at most half full, so that probes stay short
+    if( (mSize + 1) * 2 > mSlots.size() ) {
+        mGrow();
+    }
+
+    const uint64_t KEY = HASH == 0 ? 1 : HASH;
+    const uint64_t MASK = mSlots.size() - 1;
+    for( uint64_t i = KEY & MASK; ; i = (i + 1) & MASK ) {
+        if( mSlots[i] == KEY ) {
+            return false;
+        }
+
+        if( mSlots[i] == 0 ) {
+            mSlots[i] = KEY;
+            ++mSize;
+            return true;
+        }
+    }
+}
+
+void TranspositionTable::clear() {
+    if( mSlots.size() > INITIAL_CAPACITY ) {
+        vector<uint64_t>().swap( mSlots );
+    } else if( mSize > 0 ) {
+        fill( mSlots.begin(), mSlots.end(), 0 );
+    }
+
+    mSize = 0;
+}
+
+unsigned long TranspositionTable::getSize() const {
+    return mSize;
+}
+
+void TranspositionTable::mGrow() {
+    vector<uint64_t> oldSlots( mSlots.empty() ? INITIAL_CAPACITY : mSlots.size() * 2, 0 );
+    oldSlots.swap( mSlots );
+
+    const uint64_t MASK = mSlots.size() - 1;
+    for( uint64_t key : oldSlots ) {
+        if( key == 0 ) {
+            continue;
+        }
+
+        uint64_t i = key & MASK;
+        while( mSlots[i] != 0 ) {
+            i = (i + 1) & MASK;
+        }
+        mSlots[i] = key;
+    }
+}
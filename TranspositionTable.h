@@ -0,0 +1,81 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * the interface of the transposition table, which records which positions have
+ * already been searched.
+ */
+
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+#include <vector>
+
+#include <cstdint>
+
+/**
+ * @brief A set of position hashes. This is an open addressing table stored
+ * in a single array, so that recording a position rarely allocates and
+ * checking one is usually a single cache miss. The array is only allocated
+ * once the first position is recorded, and grows along with the table
+ */
+class TranspositionTable final {
+public:
+    /**
+     * @brief Create an empty table, without allocating anything yet
+     */
+    TranspositionTable();
+
+    /**
+     * @brief Record a position
+     * @param HASH The hash of the position
+     * @return true if the position was newly recorded, false if it was
+     * already in the table
+     */
+    bool insert( const uint64_t HASH );
+
+    /**
+     * @brief Remove every position from the table. A table that grew past
+     * its initial capacity releases its storage, so that one large search
+     * does not make every later search clear and probe the larger table
+     */
+    void clear();
+
+    /**
+     * @brief Get the amount of recorded positions
+     * @return The size of the table
+     */
+    unsigned long getSize() const;
+
+private:
+    /**
+     * @brief The amount of slots allocated for the first position, which
+     * must be a power of two
+     */
+    static const unsigned long INITIAL_CAPACITY = 1 << 12;
+
+    std::vector<uint64_t> mSlots;
+    unsigned long mSize;
+
+    /**
+     * @brief Double the capacity of the table, re-inserting every hash, or
+     * allocate its initial capacity if it has none
+     */
+    void mGrow();
+};
+
+#endif
@@ -0,0 +1,232 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * batch analyzer, which solves a range of deals without a display and reports
+ * which of them can be won.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "Klondike.h"
+#include "Solver.h"
+#include "SolverResult.h"
+
+/**
+ * @brief The node limit used when none is given
+ */
+const unsigned long DEFAULT_NODE_LIMIT = 1000000;
+
+/**
+ * @brief The progress of a batch, shared between the solving threads
+ */
+struct Batch {
+    uint64_t first;
+    uint64_t last;
+    unsigned long nodeLimit;
+
+    atomic<uint64_t> nextSeed;
+    atomic<bool> isLastTaken;
+    atomic<uint64_t> doneCount;
+    atomic<bool> isDone;
+    atomic<uint64_t> resultCounts[3];
+
+    mutex outputLock;
+    condition_variable doneSignal;
+};
+
+/**
+ * @brief Get the name of a solver result, as written to the output
+ * @param RESULT The result to name
+ * @return The name of the result
+ */
+const char* getResultName( const SolverResult RESULT ) {
+    switch( RESULT ) {
+        case SolverResult::WINNABLE:
+            return "winnable";
+        case SolverResult::UNWINNABLE:
+            return "unwinnable";
+        default:
+            return "undecided";
+    }
+}
+
+/**
+ * @brief Take the next deal of a batch that no thread has taken yet
+ * @param batch The batch to take the deal from
+ * @param seed The destination seed of the deal
+ * @return true if a deal was taken, false if every deal has been taken
+ */
+bool takeDeal( Batch& batch, uint64_t& seed ) {
+    // The next seed never moves past the last deal, as there may not be
+    // a seed after it to move to. The last deal is taken through a flag
+    // of its own instead
+    seed = batch.nextSeed;
+    while( seed < batch.last ) {
+        if( batch.nextSeed.compare_exchange_weak( seed, seed + 1 ) ) {
+            return true;
+        }
+    }
+
+    return !batch.isLastTaken.exchange( true );
+}
+
+/**
+ * @brief Get the amount of deals in a batch, which is written out in full
+ * as it does not fit in a 64 bit number for the batch of every deal
+ * @param BATCH The batch to count
+ * @return The amount of deals
+ */
+string getDealAmount( const Batch& BATCH ) {
+    if( BATCH.last - BATCH.first == UINT64_MAX ) {
+        return "18446744073709551616";
+    }
+
+    return to_string( BATCH.last - BATCH.first + 1 );
+}
+
+/**
+ * @brief Solve deals from a batch until every deal has been taken
+ * @param batch The batch to take deals from
+ */
+void solveDeals( Batch& batch ) {
+    // Deals are spread over the threads one at a time, rather than each
+    // deal being spread over every thread, as a single-threaded search
+    // never waits on any other
+    Solver solver( batch.nodeLimit );
+
+    uint64_t seed;
+    while( takeDeal( batch, seed ) ) {
+        const chrono::steady_clock::time_point START = chrono::steady_clock::now();
+        const SolverResult RESULT = solver.solve( Klondike( seed ) );
+        const chrono::duration<double, milli> ELAPSED = chrono::steady_clock::now() - START;
+
+        ++batch.resultCounts[RESULT];
+
+        {
+            lock_guard<mutex> guard( batch.outputLock );
+            cout << seed << ','
+                << getResultName( RESULT ) << ','
+                << solver.getSolution().size() << ','
+                << solver.getNodeCount() << ','
+                << fixed << setprecision( 3 ) << ELAPSED.count()
+                << '\n';
+        }
+
+        // The count is compared before it is increased, so that the count
+        // of every deal is never needed
+        if( batch.doneCount++ == batch.last - batch.first ) {
+            lock_guard<mutex> guard( batch.outputLock );
+            batch.isDone = true;
+            batch.doneSignal.notify_all();
+        }
+    }
+}
+
+/**
+ * @brief Report how far a batch has come on the error stream
+ * @param BATCH The batch to report on
+ * @param SECONDS The time since the batch started, in seconds
+ */
+void reportProgress( const Batch& BATCH, const double SECONDS ) {
+    const uint64_t DONE = BATCH.doneCount;
+    cerr << '\r' << DONE << '/' << getDealAmount( BATCH ) << " deals, "
+        << fixed << setprecision( 1 ) << DONE / SECONDS << " deals/s" << flush;
+}
+
+int main( int argc, char* argv[] ) {
+    if( argc < 3 ) {
+        cerr << "Usage: " << argv[0] << " FIRST_DEAL LAST_DEAL [THREADS] [NODE_LIMIT]" << endl;
+        return -1;
+    }
+
+    Batch batch;
+    batch.first = strtoull( argv[1], nullptr, 10 );
+    batch.last = strtoull( argv[2], nullptr, 10 );
+    if( batch.last < batch.first ) {
+        cerr << "The last deal must not come before the first deal" << endl;
+        return -1;
+    }
+
+    // Use every core unless told otherwise. The standard library may not
+    // know how many cores there are, in which case it reports zero
+    unsigned int threadAmount = thread::hardware_concurrency();
+    if( argc > 3 ) {
+        threadAmount = strtoul( argv[3], nullptr, 10 );
+    }
+    if( threadAmount == 0 ) {
+        threadAmount = 1;
+    }
+
+    batch.nodeLimit = DEFAULT_NODE_LIMIT;
+    if( argc > 4 ) {
+        batch.nodeLimit = strtoul( argv[4], nullptr, 10 );
+    }
+
+    batch.nextSeed = batch.first;
+    batch.isLastTaken = false;
+    batch.doneCount = 0;
+    batch.isDone = false;
+    for( atomic<uint64_t>& count : batch.resultCounts ) {
+        count = 0;
+    }
+
+    const chrono::steady_clock::time_point START = chrono::steady_clock::now();
+
+    cout << "deal,result,moves,nodes,milliseconds\n";
+    vector<thread> threads;
+    for( unsigned int i = 0; i < threadAmount; ++i ) {
+        threads.push_back( thread( solveDeals, ref( batch ) ) );
+    }
+
+    // Report progress once a second until every deal is done
+    unique_lock<mutex> lock( batch.outputLock );
+    while( !batch.doneSignal.wait_for( lock, chrono::seconds( 1 ), [&batch] {
+        return batch.isDone.load();
+    } ) ) {
+        const chrono::duration<double> ELAPSED = chrono::steady_clock::now() - START;
+        reportProgress( batch, ELAPSED.count() );
+    }
+    lock.unlock();
+
+    for( thread& t : threads ) {
+        t.join();
+    }
+
+    const chrono::duration<double> ELAPSED = chrono::steady_clock::now() - START;
+    reportProgress( batch, ELAPSED.count() );
+    cerr << endl;
+
+    cerr << "Winnable: " << batch.resultCounts[SolverResult::WINNABLE]
+        << ", Unwinnable: " << batch.resultCounts[SolverResult::UNWINNABLE]
+        << ", Undecided: " << batch.resultCounts[SolverResult::UNDECIDED]
+        << endl;
+
+    return 0;
+}
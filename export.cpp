@@ -0,0 +1,85 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * history exporter tool, which writes every past game out as CSV or JSON Lines
+ * for other programs to read.
+ */
+
+#include <iostream>
+using namespace std;
+
+#include <cstring>
+
+#include "ExportFormat.h"
+#include "HistoryExporter.h"
+
+int main( int argc, char* argv[] ) {
+    if( argc < 2 ) {
+        cerr << "Usage: " << argv[0] << " csv|jsonl [duration] [streak]" << endl;
+        return -1;
+    }
+
+    ExportFormat format;
+    if( strcmp( argv[1], "csv" ) == 0 ) {
+        format = ExportFormat::CSV;
+    } else if( strcmp( argv[1], "jsonl" ) == 0 ) {
+        format = ExportFormat::JSON_LINES;
+    } else {
+        cerr << "Unknown format " << argv[1] << ", expected csv or jsonl" << endl;
+        return -1;
+    }
+
+    bool withDuration = false;
+    bool withStreak = false;
+    for( int i = 2; i < argc; ++i ) {
+        if( strcmp( argv[i], "duration" ) == 0 ) {
+            withDuration = true;
+        } else if( strcmp( argv[i], "streak" ) == 0 ) {
+            withStreak = true;
+        } else {
+            cerr << "Unknown column " << argv[i] << ", expected duration or streak" << endl;
+            return -1;
+        }
+    }
+
+    // The exporter does its own buffering, so the standard output is not
+    // kept in step with C stdio
+    ios::sync_with_stdio( false );
+
+    HistoryExporter exporter( cout, format );
+    exporter.setColumns( withDuration, withStreak );
+
+    if( !exporter.exportHistory() ) {
+        cerr << "Unable to export the history" << endl;
+        exporter.finish();
+        return -1;
+    }
+
+    if( !exporter.finish() ) {
+        cerr << "Unable to write the exported games" << endl;
+        return -1;
+    }
+
+    cerr << "Exported " << exporter.getExportedCount() << " games";
+    if( exporter.getSkippedCount() > 0 ) {
+        cerr << ", skipped " << exporter.getSkippedCount() << " incomplete history entries";
+    }
+    cerr << endl;
+
+    return 0;
+}
@@ -26,13 +26,16 @@ using namespace sf;
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <string>
 using namespace std;
 
 #include <cstdlib>
 #include <ctime>
 
+#include "DayRollup.h"
 #include "History.h"
-#include "Selection.h"
+#include "QuantileSketch.h"
+#include "SecondTimer.h"
 #include "Solitaire.h"
 #include "Statistics.h"
 
@@ -81,12 +84,41 @@ string formatDuration( const long DURATION ) {
     return dst;
 }
 
+/**
+ * @brief Format the median, 90th percentile, and 99th percentile of a
+ * distribution into a "MEDIAN / P90 / P99" string
+ * @param SKETCH The distribution to format
+ * @param IS_DURATION If the values are durations in seconds, which are
+ * formatted as such, rather than plain amounts
+ * @return A formatted string
+ */
+string formatQuantiles( const QuantileSketch& SKETCH, const bool IS_DURATION ) {
+    const double QUANTILES[3] = { 0.5, 0.9, 0.99 };
+
+    string dst;
+    for( unsigned int i = 0; i < 3; ++i ) {
+        if( i > 0 ) {
+            dst += " / ";
+        }
+
+        const uint64_t VALUE = SKETCH.getQuantile( QUANTILES[i] );
+        if( IS_DURATION ) {
+            dst += formatDuration( VALUE );
+        } else {
+            dst += to_string( VALUE );
+        }
+    }
+
+    return dst;
+}
+
 /**
  * @brief Save the given statistics to the statistics file.
  * @param STATISTICS The statistics to write to the file
+ * @param LAST_WEEK The totals of the games of the last seven days
  * @return true if the file was successfully written, false otherwise
  */
-bool saveStatistics( const Statistics STATISTICS ) {
+bool saveStatistics( const Statistics STATISTICS, const DayRollup& LAST_WEEK ) {
     // This is placed within the main file for two reasons:
     // 1. The main file shows most of the user-facing information, so
     // it should also be responsible for the user-facing statistics
@@ -158,19 +190,52 @@ bool saveStatistics( const Statistics STATISTICS ) {
         statisticsOut << "Smallest Winning Moves: "
             << STATISTICS.smallestWinMoves
             << endl;
+
+        // Also write how long and how many moves winning usually takes,
+        // as the median and the 90th/99th percentiles
+        statisticsOut << "Winning Time (Median / 90% / 99%): "
+            << formatQuantiles( STATISTICS.winDurations, true )
+            << endl;
+
+        statisticsOut << "Winning Moves (Median / 90% / 99%): "
+            << formatQuantiles( STATISTICS.winMoves, false )
+            << endl;
     } else {
         statisticsOut << "Smallest Winning Moves: N/A" << endl;
         statisticsOut << "Smallest Losing Moves: N/A" << endl;
     }
 
+    // The same goes for lost games, if there are any
+    if( STATISTICS.wins < STATISTICS.totalGames ) {
+        statisticsOut << "Losing Time (Median / 90% / 99%): "
+            << formatQuantiles( STATISTICS.lossDurations, true )
+            << endl;
+
+        statisticsOut << "Losing Moves (Median / 90% / 99%): "
+            << formatQuantiles( STATISTICS.lossMoves, false )
+            << endl;
+    }
+
+    // Write how the last week went, if any games were played in it
+    if( LAST_WEEK.games > 0 ) {
+        statisticsOut << "Last 7 Days: "
+            << LAST_WEEK.games << " Games, "
+            << LAST_WEEK.wins << " Wins ("
+            << (double) LAST_WEEK.wins / LAST_WEEK.games * 100
+            << "%)";
+        if( LAST_WEEK.wins > 0 ) {
+            statisticsOut << ", Shortest Winning Time: "
+                << formatDuration( LAST_WEEK.shortestWinDuration );
+        }
+        statisticsOut << endl;
+    }
+
     statisticsOut.close();
 
     return true;
 }
 
-int main() {
-    srand( time( 0 ) );
-    rand();
+int main( int argc, char* argv[] ) {
 
     // Load the game textures. To speed up loading, instead of many texture files
     // for each card, instead a spritesheet is loaded that contains all cards, with
@@ -189,13 +254,17 @@ int main() {
         return -1;
     }
 
-    // Generate a new solitaire game
-    Solitaire* pSolitaire = new Solitaire;
-    Selection* pSelection = nullptr;
+    // Generate a new solitaire game. A deal number can be given as the
+    // first argument to replay a particular deal
+    Solitaire* pSolitaire;
+    if( argc > 1 ) {
+        pSolitaire = new Solitaire( strtoull( argv[1], nullptr, 10 ) );
+    } else {
+        pSolitaire = new Solitaire;
+    }
 
     // Create a window
     RenderWindow window( VideoMode( 576, 576 ), "FP", Style::Titlebar | Style::Close );
-    window.setFramerateLimit( 60 );
 
     // Instead of providing the texture to game elements, it is provided to
     // the window instead, and game elements simply operate under the assumption
@@ -210,89 +279,149 @@ int main() {
     infoText.setCharacterSize( 16 );
     infoText.setPosition( 16, 544 );
 
+    // Load the history of past games. Each game is written to it as soon
+    // as it is over, so that it is kept even if the program does not get to
+    // exit normally
+    History* pHistory = new History;
+    const bool HISTORY_LOADED = pHistory->load();
+    if( !HISTORY_LOADED ) {
+        cerr << "Unable to open history file" << endl;
+    }
+    bool isRecorded = false;
+
     // Create an event object to re-use for future events
     Event event;
 
+    // Frames are only drawn when something on screen changed, rather than
+    // continuously, so that an idle game does not keep the CPU busy. The
+    // information text is tracked separately, as the game time changes on
+    // its own without any events
+    bool isDirty = true;
+    SolitaireInfo shownInfo;
+    long shownDuration = -1;
+
+    // The window waits for events between frames. The game time changes
+    // without any, so the timer wakes the window whenever it may show a
+    // new second
+    SecondTimer timer( window.getSystemHandle() );
+
     // While the window is open
     while( window.isOpen() ) {
-        // Clear the previous frame with a dark green background
-        window.clear( Color( 0, 64, 0 ) );
-
-        // Draw the game elements
-        window.draw( infoText );
-        window.draw( *pSolitaire, states );
-        if( pSelection != nullptr ) {
-            // If available, draw selections last, as they should
-            // not clip behind any other game elements
-            window.draw( *pSelection, states );
+        // Update the information text only if what it shows has changed
+        const SolitaireInfo INFO = pSolitaire->getInfo();
+        const long DURATION = INFO.getDuration();
+        if( shownDuration < 0 
+            || INFO.win != shownInfo.win 
+            || INFO.moves != shownInfo.moves 
+            || DURATION != shownDuration ) {
+            string infoString;
+            if( INFO.win ) {
+                infoString += "You Win! | ";
+            }
+
+            infoString += "Moves: ";
+            infoString += to_string( INFO.moves );
+
+            infoString += " | Time: ";
+            infoString += formatDuration( DURATION );
+
+            infoText.setString( infoString );
+
+            if( INFO.win && HISTORY_LOADED && !isRecorded ) {
+                // The game just ended, record it right away
+                if( !pHistory->add( INFO ) ) {
+                    cerr << "Unable to save history file" << endl;
+                }
+                isRecorded = true;
+            }
+
+            shownInfo = INFO;
+            shownDuration = DURATION;
+            isDirty = true;
+        }
+
+        if( isDirty ) {
+            // Clear the previous frame with a dark green background
+            window.clear( Color( 0, 64, 0 ) );
+
+            // Draw the game elements
+            window.draw( infoText );
+            window.draw( *pSolitaire, states );
+
+            // Display the new frame
+            window.display();
+            isDirty = false;
         }
 
-        // Display the new frame
-        window.display();
-        
-        while( window.pollEvent( event ) ) {
+        // Once the game is won, the clock stops, so nothing can change until
+        // the next event
+        timer.setActive( !INFO.win );
+
+        bool hasEvent = window.waitEvent( event );
+        while( hasEvent ) {
             if( event.type == Event::Closed ) {
-                // Window closed
+                // Window closed. The timer is stopped first, as it cannot
+                // wake a window that no longer exists
+                timer.setActive( false );
                 window.close();
             }
 
+            if( event.type == Event::EventType::Resized 
+                || event.type == Event::EventType::GainedFocus ) {
+                // The window contents may have been lost
+                isDirty = true;
+            }
+
             if( event.type == Event::EventType::MouseButtonPressed 
                 && event.mouseButton.button == Mouse::Button::Left ) {
-                // Game element possibly clicked, if something is clicked,
-                // pSelection will already be modified, so there is nothing
-                // we need to do on our end
-                pSolitaire->click( 
-                    Vector2i( event.mouseButton.x, event.mouseButton.y ), pSelection );
+                // Game element possibly clicked, which may pick up cards
+                pSolitaire->click( Vector2i( event.mouseButton.x, event.mouseButton.y ) );
+                isDirty = true;
             }
 
-            if( event.type == Event::EventType::MouseMoved && pSelection != nullptr ) {
+            if( event.type == Event::EventType::MouseMoved && pSolitaire->hasSelection() ) {
                 // Mouse moved, update the selection position if we have one
-                pSelection->setMousePosition( 
-                    Vector2i( event.mouseMove.x, event.mouseMove.y ) );
+                pSolitaire->drag( Vector2i( event.mouseMove.x, event.mouseMove.y ) );
+                isDirty = true;
             }
 
-            if( event.type == Event::EventType::MouseButtonReleased && pSelection != nullptr) {
+            if( event.type == Event::EventType::MouseButtonReleased && pSolitaire->hasSelection() ) {
                 // Mouse released, release the selection
-                pSolitaire->release( pSelection );
+                pSolitaire->release();
+                isDirty = true;
             }
-        }
 
-        // Update the information text with the possibly changed
-        // game state
-        const SolitaireInfo INFO = pSolitaire->getInfo();
+            if( event.type == Event::EventType::KeyPressed && event.key.control 
+                && !pSolitaire->hasSelection() ) {
+                // Ctrl+Z takes back a move, while Ctrl+Y or Ctrl+Shift+Z
+                // performs it again. Cards that are being held have to be
+                // dropped first, as they belong to the current position
+                if( event.key.code == Keyboard::Key::Y 
+                    || ( event.key.code == Keyboard::Key::Z && event.key.shift ) ) {
+                    isDirty = pSolitaire->redo() || isDirty;
+                } else if( event.key.code == Keyboard::Key::Z ) {
+                    isDirty = pSolitaire->undo() || isDirty;
+                }
+            }
 
-        string infoString;
-        if( INFO.win ) {
-            infoString += "You Win! | ";
+            hasEvent = window.pollEvent( event );
         }
-
-        infoString += "Moves: ";
-        infoString += to_string( INFO.moves );
-
-        infoString += " | Time: ";
-        infoString += formatDuration( INFO.getDuration() );
-
-        infoText.setString( infoString );
     }
 
-    History* pHistory = new History;
-    if( pHistory->load() ) {
-        // Successfully loaded history, add this game to it
-        pHistory->add( pSolitaire->getInfo() );
+    if( HISTORY_LOADED ) {
+        // A game that was not won ends when the window closes
+        if( !isRecorded && !pHistory->add( pSolitaire->getInfo() ) ) {
+            cerr << "Unable to save history file" << endl;
+        }
 
         // Calculate the new statistics that includes the current game,
         // and then try to write it out to it's file
         Statistics statistics = pHistory->getStatistics();
-        if( !saveStatistics( statistics ) ) {
+        const int64_t TODAY = DayRollup::getDay( time( nullptr ) );
+        const DayRollup LAST_WEEK = pHistory->getIndex().getRange( TODAY - 6, TODAY );
+        if( !saveStatistics( statistics, LAST_WEEK ) ) {
             cerr << "Unable to save statistics file" << endl;
         }
-
-        // Save the new information back to the history file
-        if( !pHistory->save() ) {
-            cerr << "Unable to save history file" << endl;
-        }
-    } else {
-        cerr << "Unable to open history file" << endl;
     }
 
     delete pHistory;
@@ -0,0 +1,159 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * history columns test, which checks that games held in columns are read
+ * back exactly and summarize the same as adding them one at a time.
+ */
+
+#include <iostream>
+#include <vector>
+using namespace std;
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "HistoryColumns.h"
+#include "SolitaireInfo.h"
+#include "StatisticsSummary.h"
+
+/**
+ * @brief The amount of games in the test history, which leaves the last
+ * block partly full
+ */
+const unsigned long GAME_AMOUNT = 100000 + 37;
+
+/**
+ * @brief The amount of random ranges of games to summarize
+ */
+const int RANGE_AMOUNT = 200;
+
+/**
+ * @brief Make a history of games, mostly played one after another, with
+ * the occasional game that has an extreme value in some field
+ * @return The games, in the order they were played
+ */
+vector<SolitaireInfo> makeGames() {
+    vector<SolitaireInfo> games;
+    long time = 1300000000;
+    srand( 200 );
+
+    for( unsigned long i = 0; i < GAME_AMOUNT; ++i ) {
+        SolitaireInfo info;
+        // Wins come in runs, so that streaks cross between blocks
+        info.win = (i / (1 + rand() % 100)) % 2 == 0;
+        info.moves = 50 + rand() % 300;
+        info.startTime = time + rand() % 3600;
+        info.endTime = info.startTime + 30 + rand() % 900;
+
+        if( rand() % 1000 == 0 ) {
+            info.moves = UINT32_MAX - rand() % 10;
+        }
+
+        if( rand() % 1000 == 0 ) {
+            // A clock that was set back during a game
+            info.endTime = info.startTime - rand() % 100000;
+        }
+
+        time = info.endTime;
+        games.push_back( info );
+    }
+
+    return games;
+}
+
+/**
+ * @brief Check that two summaries hold the same statistics
+ * @param EXPECTED The summary made one game at a time
+ * @param ACTUAL The summary made from the columns
+ * @return true if the summaries are the same, false otherwise
+ */
+bool isSameSummary( const StatisticsSummary& EXPECTED, const StatisticsSummary& ACTUAL ) {
+    return EXPECTED.games == ACTUAL.games 
+        && EXPECTED.wins == ACTUAL.wins 
+        && (EXPECTED.games == 0 || EXPECTED.isFirstWin == ACTUAL.isFirstWin) 
+        && EXPECTED.firstStreakLength == ACTUAL.firstStreakLength 
+        && (EXPECTED.games == 0 || EXPECTED.isLastWin == ACTUAL.isLastWin) 
+        && EXPECTED.lastStreakLength == ACTUAL.lastStreakLength 
+        && EXPECTED.longestWinningStreak == ACTUAL.longestWinningStreak 
+        && EXPECTED.longestLosingStreak == ACTUAL.longestLosingStreak 
+        && (EXPECTED.wins == 0 || EXPECTED.shortestWinDuration == ACTUAL.shortestWinDuration) 
+        && (EXPECTED.wins == 0 || EXPECTED.smallestWinMoves == ACTUAL.smallestWinMoves) 
+        && memcmp( &EXPECTED.winDurations, &ACTUAL.winDurations, sizeof( QuantileSketch ) ) == 0 
+        && memcmp( &EXPECTED.winMoves, &ACTUAL.winMoves, sizeof( QuantileSketch ) ) == 0 
+        && memcmp( &EXPECTED.lossDurations, &ACTUAL.lossDurations, sizeof( QuantileSketch ) ) == 0 
+        && memcmp( &EXPECTED.lossMoves, &ACTUAL.lossMoves, sizeof( QuantileSketch ) ) == 0;
+}
+
+/**
+ * @brief Check a summary of a range of games against adding them one at a
+ * time
+ * @param GAMES The games that were added to the columns
+ * @param COLUMNS The columns holding the games
+ * @param BEGIN The position of the first game to summarize
+ * @param END The position after the last game to summarize
+ * @return true if the summaries are the same, false otherwise
+ */
+bool checkRange( 
+    const vector<SolitaireInfo>& GAMES, 
+    const HistoryColumns& COLUMNS, 
+    const unsigned long BEGIN, 
+    const unsigned long END 
+) {
+    StatisticsSummary expected = StatisticsSummary();
+    for( unsigned long i = BEGIN; i < END; ++i ) {
+        expected.add( GAMES[i] );
+    }
+
+    if( !isSameSummary( expected, StatisticsSummary::fromColumns( COLUMNS, BEGIN, END ) ) ) {
+        cerr << "Summaries differ for games " << BEGIN << " to " << END << endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main() {
+    const vector<SolitaireInfo> GAMES = makeGames();
+    HistoryColumns columns;
+    for( const SolitaireInfo& INFO : GAMES ) {
+        columns.add( INFO );
+    }
+
+    bool passed = columns.getSize() == GAMES.size();
+    for( unsigned long i = 0; i < GAMES.size() && passed; ++i ) {
+        const SolitaireInfo INFO = columns.getInfo( i );
+        if( INFO.win != GAMES[i].win 
+            || INFO.moves != GAMES[i].moves 
+            || INFO.startTime != GAMES[i].startTime 
+            || INFO.endTime != GAMES[i].endTime ) {
+            cerr << "Game " << i << " was not read back as it was added" << endl;
+            passed = false;
+        }
+    }
+
+    passed = passed && checkRange( GAMES, columns, 0, GAMES.size() );
+    for( int i = 0; i < RANGE_AMOUNT && passed; ++i ) {
+        const unsigned long BEGIN = rand() % GAMES.size();
+        const unsigned long END = BEGIN + rand() % (GAMES.size() - BEGIN + 1);
+        passed = checkRange( GAMES, columns, BEGIN, END );
+    }
+
+    cout << "history columns: " << (passed ? "passed" : "FAILED") << endl;
+    return passed ? 0 : 1;
+}
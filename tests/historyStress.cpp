@@ -0,0 +1,499 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * history stress test, which has many processes add games to the same history at
+ * once and checks that none of them are lost.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ExportFormat.h"
+#include "FileLock.h"
+#include "History.h"
+#include "HistoryExporter.h"
+#include "HistoryHeader.h"
+#include "HistoryRecord.h"
+
+/**
+ * @brief The amount of processes that add games at the same time
+ */
+const int WRITER_AMOUNT = 32;
+
+/**
+ * @brief The amount of games each process adds
+ */
+const int ADD_AMOUNT = 20;
+
+/**
+ * @brief The amount of games in the text history that the test starts
+ * with, which is enough for the first game added to also archive them
+ */
+const int TEXT_AMOUNT = 5000;
+
+/**
+ * @brief Every game gets a unique move count, which is how games are told
+ * apart when checking the history
+ * @param WRITER The process that added the game
+ * @param INDEX The position of the game among those the process added
+ * @return The move count of the game
+ */
+unsigned int getMoves( const int WRITER, const int INDEX ) {
+    return (WRITER + 1) * 100000 + INDEX + 1;
+}
+
+/**
+ * @brief Write a history in the older text format, which every process
+ * races to migrate and archive when adding its first game
+ */
+void writeTextHistory() {
+    ofstream historyOut( "data/history.dat" );
+    historyOut << TEXT_AMOUNT << '\n';
+    for( int i = 0; i < TEXT_AMOUNT; ++i ) {
+        const int64_t START_TIME = 1300000000 + i * 3600;
+        historyOut << (i % 3 == 0) << ' ' << getMoves( -1, i ) << ' ' 
+            << START_TIME << ' ' << START_TIME + 100 << '\n';
+    }
+}
+
+/**
+ * @brief Add games to the history, as another running game would
+ * @param WRITER The number of the process
+ * @return The exit status of the process
+ */
+int runWriter( const int WRITER ) {
+    History history;
+    history.setSyncPolicy( WRITER % 2 == 0 ? SyncPolicy::NEVER : SyncPolicy::EVERY_APPEND );
+    if( !history.load() ) {
+        return 2;
+    }
+
+    for( int i = 0; i < ADD_AMOUNT; ++i ) {
+        const int64_t START_TIME = 1700000000 + WRITER * 100000 + i * 100;
+        const SolitaireInfo INFO { (WRITER + i) % 2 == 0, getMoves( WRITER, i ), START_TIME, START_TIME + 50 };
+        if( !history.add( INFO ) ) {
+            return 3;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Count every game in the history files by its move count
+ * @param counts The destination counts
+ * @return The amount of games
+ */
+unsigned long countGames( map<unsigned int, unsigned int>& counts ) {
+    unsigned long total = 0;
+    for( const string& PATH : History::getFilePaths() ) {
+        ifstream historyIn( PATH, ios::binary );
+        HistoryHeader header;
+        historyIn.read( reinterpret_cast<char*>( &header ), sizeof( header ) );
+
+        HistoryRecord record;
+        while( historyIn.read( reinterpret_cast<char*>( &record ), sizeof( record ) ) ) {
+            if( record.isValid() ) {
+                ++counts[record.toInfo().moves];
+                ++total;
+            }
+        }
+    }
+
+    return total;
+}
+
+/**
+ * @brief Export the history as CSV and read the games back by their move
+ * counts
+ * @param counts The destination counts
+ * @return The amount of games exported, or -1 if the export failed
+ */
+long exportGames( map<unsigned int, unsigned int>& counts ) {
+    ostringstream out;
+    HistoryExporter exporter( out, ExportFormat::CSV );
+    if( !exporter.exportHistory() || !exporter.finish() ) {
+        return -1;
+    }
+
+    // The first line names the columns, and the moves are the second
+    istringstream in( out.str() );
+    string line;
+    getline( in, line );
+    long total = 0;
+    while( getline( in, line ) ) {
+        ++counts[strtoul( line.c_str() + line.find( ',' ) + 1, nullptr, 10 )];
+        ++total;
+    }
+
+    return total;
+}
+
+/**
+ * @brief Have every writer add its games at once, and check that the
+ * history ends up with each game exactly once
+ * @return true if the test passed, false otherwise
+ */
+bool testConcurrentWriters() {
+    writeTextHistory();
+
+    vector<pid_t> writers;
+    for( int i = 0; i < WRITER_AMOUNT; ++i ) {
+        const pid_t PID = fork();
+        if( PID == 0 ) {
+            _exit( runWriter( i ) );
+        }
+        writers.push_back( PID );
+    }
+
+    int failedAmount = 0;
+    for( const pid_t PID : writers ) {
+        int status;
+        waitpid( PID, &status, 0 );
+        if( !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ) {
+            ++failedAmount;
+        }
+    }
+
+    if( failedAmount > 0 ) {
+        cerr << failedAmount << " writers failed to add their games" << endl;
+        return false;
+    }
+
+    map<unsigned int, unsigned int> counts;
+    const unsigned long TOTAL = countGames( counts );
+    const unsigned long EXPECTED = TEXT_AMOUNT + WRITER_AMOUNT * ADD_AMOUNT;
+    if( TOTAL != EXPECTED || counts.size() != EXPECTED ) {
+        cerr << "Expected " << EXPECTED << " games, found " << TOTAL << " (" << counts.size() << " unique)" << endl;
+        return false;
+    }
+
+    // The saved statistics have to agree with counting every game again
+    History history;
+    history.load();
+    const Statistics SAVED = history.getStatistics();
+    remove( "data/statistics.dat" );
+    History recounted;
+    recounted.load();
+    const Statistics RECOUNTED = recounted.getStatistics();
+    if( SAVED.totalGames != EXPECTED || RECOUNTED.totalGames != EXPECTED || SAVED.wins != RECOUNTED.wins ) {
+        cerr << "Statistics cover " << SAVED.totalGames << " and " << RECOUNTED.totalGames 
+            << " games, expected " << EXPECTED << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Export the history over and over while the writers migrate,
+ * archive and add to it, and check that every export has each game that
+ * was there before it exactly once
+ * @return true if the test passed, false otherwise
+ */
+bool testConcurrentExport() {
+    writeTextHistory();
+
+    vector<pid_t> writers;
+    for( int i = 0; i < WRITER_AMOUNT; ++i ) {
+        const pid_t PID = fork();
+        if( PID == 0 ) {
+            _exit( runWriter( i ) );
+        }
+        writers.push_back( PID );
+    }
+
+    // Games are never removed, so each export has to have at least every
+    // game of the one before it
+    unsigned long lastTotal = 0;
+    unsigned long remaining = writers.size();
+    int exportAmount = 0;
+    bool passed = true;
+    while( passed ) {
+        for( const pid_t PID : writers ) {
+            if( waitpid( PID, nullptr, WNOHANG ) == PID ) {
+                --remaining;
+            }
+        }
+
+        // One more export is made after the last writer is done
+        const bool IS_LAST = remaining == 0;
+
+        map<unsigned int, unsigned int> counts;
+        const long TOTAL = exportGames( counts );
+        ++exportAmount;
+        if( TOTAL < (long) lastTotal || counts.size() != (unsigned long) TOTAL ) {
+            cerr << "Export " << exportAmount << " has " << TOTAL << " games (" << counts.size() 
+                << " unique), after an export with " << lastTotal << endl;
+            passed = false;
+        }
+        lastTotal = TOTAL;
+
+        if( IS_LAST ) {
+            break;
+        }
+    }
+
+    const unsigned long EXPECTED = TEXT_AMOUNT + WRITER_AMOUNT * ADD_AMOUNT;
+    if( passed && lastTotal != EXPECTED ) {
+        cerr << "Expected " << EXPECTED << " games, exported " << lastTotal << endl;
+        passed = false;
+    }
+
+    return passed;
+}
+
+/**
+ * @brief Check that an export waits for another instance holding the lock
+ * on the history, such as while it archives games
+ * @return true if the test passed, false otherwise
+ */
+bool testExportLock() {
+    writeTextHistory();
+
+    // The export is forked before the lock is taken, as a child would
+    // otherwise share the lock of its parent
+    int pipeFds[2];
+    if( pipe( pipeFds ) != 0 ) {
+        cerr << "Unable to create a pipe" << endl;
+        return false;
+    }
+
+    const pid_t PID = fork();
+    if( PID == 0 ) {
+        close( pipeFds[1] );
+        char go;
+        map<unsigned int, unsigned int> counts;
+        const bool IS_READY = read( pipeFds[0], &go, 1 ) == 1;
+        _exit( IS_READY && exportGames( counts ) == TEXT_AMOUNT ? 0 : 1 );
+    }
+    close( pipeFds[0] );
+
+    FileLock lock;
+    const bool IS_LOCKED = History::lockFiles( lock );
+    const bool IS_SIGNALED = write( pipeFds[1], "g", 1 ) == 1;
+    close( pipeFds[1] );
+    usleep( 300000 );
+
+    const bool IS_WAITING = waitpid( PID, nullptr, WNOHANG ) == 0;
+    lock.unlock();
+
+    int status;
+    waitpid( PID, &status, 0 );
+    if( !IS_LOCKED || !IS_SIGNALED || !IS_WAITING ) {
+        cerr << "The export did not wait for the lock" << endl;
+        return false;
+    }
+
+    if( !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ) {
+        cerr << "The export failed after the lock was released" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check that a history without any games exports no games, whether
+ * its file is missing or empty, and that a text history can be exported
+ * before the game migrates it
+ * @return true if the test passed, false otherwise
+ */
+bool testExportFormats() {
+    map<unsigned int, unsigned int> counts;
+    if( exportGames( counts ) != 0 ) {
+        cerr << "Exported games from a missing history" << endl;
+        return false;
+    }
+
+    ofstream( "data/history.dat" ).close();
+    if( exportGames( counts ) != 0 ) {
+        cerr << "Exported games from an empty history" << endl;
+        return false;
+    }
+
+    writeTextHistory();
+    if( exportGames( counts ) != TEXT_AMOUNT || counts.size() != (unsigned long) TEXT_AMOUNT ) {
+        cerr << "Expected " << TEXT_AMOUNT << " games from a text history" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check that games which could not be saved are kept through
+ * another instance replacing the file, and saved with the next game
+ * @return true if the test passed, false otherwise
+ */
+bool testUnsavedGames() {
+    writeTextHistory();
+
+    History first;
+    first.load();
+
+    // A directory in place of the lock file keeps the lock from being
+    // taken, even when running as root
+    remove( "data/history.lock" );
+    if( mkdir( "data/history.lock", 0755 ) != 0 ) {
+        cerr << "Unable to block the lock" << endl;
+        return false;
+    }
+    for( int i = 0; i < 3; ++i ) {
+        const SolitaireInfo INFO { true, getMoves( 0, i ), 1800000000 + i, 1800000010 + i };
+        if( first.add( INFO ) ) {
+            cerr << "Added a game without the lock" << endl;
+            return false;
+        }
+    }
+    rmdir( "data/history.lock" );
+
+    // Migrating the text history replaces the file under the first instance
+    History second;
+    second.load();
+    if( !second.add( SolitaireInfo { false, getMoves( 1, 0 ), 1800001000, 1800001010 } ) ) {
+        cerr << "Unable to add a game from the second instance" << endl;
+        return false;
+    }
+
+    if( !first.add( SolitaireInfo { true, getMoves( 0, 3 ), 1800002000, 1800002010 } ) ) {
+        cerr << "Unable to add a game from the first instance" << endl;
+        return false;
+    }
+
+    map<unsigned int, unsigned int> counts;
+    const unsigned long TOTAL = countGames( counts );
+    for( int i = 0; i < 4; ++i ) {
+        if( counts[getMoves( 0, i )] != 1 ) {
+            cerr << "Lost unsaved game " << i << endl;
+            return false;
+        }
+    }
+
+    if( TOTAL != TEXT_AMOUNT + 5 || first.getStatistics().totalGames != TEXT_AMOUNT + 5 ) {
+        cerr << "Expected " << TEXT_AMOUNT + 5 << " games, found " << TOTAL << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Damage one byte of a record in the history file, so that it no
+ * longer matches its checksum
+ * @param INDEX The position of the record in the file
+ */
+void damageRecord( const unsigned long INDEX ) {
+    fstream historyFile( "data/history.dat", ios::in | ios::out | ios::binary );
+    const streamoff OFFSET = sizeof( HistoryHeader ) + INDEX * sizeof( HistoryRecord );
+    char byte;
+    historyFile.seekg( OFFSET );
+    historyFile.get( byte );
+    historyFile.seekp( OFFSET );
+    historyFile.put( byte ^ 1 );
+}
+
+/**
+ * @brief Check that loading only checks the records after those that the
+ * saved statistics cover, and checks every record without them
+ * @return true if the test passed, false otherwise
+ */
+bool testCheckedRecords() {
+    History history;
+    history.load();
+    for( int i = 0; i < 10; ++i ) {
+        if( i == 8 ) {
+            rename( "data/statistics.dat", "data/statistics.old" );
+        }
+
+        const SolitaireInfo INFO { i % 2 == 0, getMoves( 0, i ), 1800000000 + i * 100, 1800000050 + i * 100 };
+        if( !history.add( INFO ) ) {
+            cerr << "Unable to add game " << i << endl;
+            return false;
+        }
+    }
+
+    // The older statistics only cover the first eight records, so damage
+    // to one of those goes unnoticed, while damage to a later one does not
+    rename( "data/statistics.old", "data/statistics.dat" );
+    damageRecord( 3 );
+    damageRecord( 8 );
+
+    History checked;
+    checked.load();
+    if( checked.getGameCount() != 9 ) {
+        cerr << "Expected 9 games with statistics, found " << checked.getGameCount() << endl;
+        return false;
+    }
+
+    remove( "data/statistics.dat" );
+    History unchecked;
+    unchecked.load();
+    if( unchecked.getGameCount() != 8 ) {
+        cerr << "Expected 8 games without statistics, found " << unchecked.getGameCount() << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Run a test in a fresh directory of its own
+ * @param NAME The name of the test
+ * @param test The test to run
+ * @return true if the test passed, false otherwise
+ */
+bool runTest( const char* NAME, bool (*test)() ) {
+    char directory[] = "/tmp/historyStressXXXXXX";
+    if( mkdtemp( directory ) == nullptr || chdir( directory ) != 0 || mkdir( "data", 0755 ) != 0 ) {
+        cerr << "Unable to create a directory for " << NAME << endl;
+        return false;
+    }
+
+    const bool PASSED = test();
+    cout << NAME << ": " << (PASSED ? "passed" : "FAILED") << endl;
+
+    const string COMMAND = string( "rm -rf " ) + directory;
+    if( system( COMMAND.c_str() ) != 0 ) {
+        cerr << "Unable to remove " << directory << endl;
+    }
+
+    return PASSED;
+}
+
+int main() {
+    const bool PASSED = runTest( "concurrent writers", testConcurrentWriters )
+        & runTest( "unsaved games", testUnsavedGames )
+        & runTest( "checked records", testCheckedRecords )
+        & runTest( "concurrent export", testConcurrentExport )
+        & runTest( "export lock", testExportLock )
+        & runTest( "export formats", testExportFormats );
+    return PASSED ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * legal move test, which checks that the stock is only offered as a move while
+ * the deck has cards to turn.
+ */
+
+#include <iostream>
+using namespace std;
+
+#include <cstdint>
+#include <vector>
+
+#include "Klondike.h"
+#include "Move.h"
+#include "Pile.h"
+#include "Solver.h"
+#include "SolverResult.h"
+
+/**
+ * @brief The amount of deals whose solutions are played through
+ */
+const uint64_t DEAL_AMOUNT = 20;
+
+/**
+ * @brief The most nodes searched for the solution of each deal
+ */
+const unsigned long NODE_LIMIT = 30000;
+
+/**
+ * @brief Check if a position lists the stock as a legal move
+ * @param GAME The position to check
+ * @return true if a stock turn is among the legal moves, false otherwise
+ */
+bool hasStockMove( const Klondike& GAME ) {
+    Move moves[Klondike::MAX_MOVES];
+    const unsigned int AMOUNT = GAME.getLegalMoves( moves, Klondike::MAX_MOVES );
+    for( unsigned int i = 0; i < AMOUNT; ++i ) {
+        if( moves[i].from == Pile::STOCK ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int main() {
+    // Winning plays through every kind of deck, including one that has
+    // been emptied before the game is over
+    Solver solver( NODE_LIMIT );
+    unsigned long emptyDecks = 0;
+    bool isPassed = true;
+    for( uint64_t deal = 1; deal <= DEAL_AMOUNT; ++deal ) {
+        Klondike game( deal );
+        if( solver.solve( game ) != SolverResult::WINNABLE ) {
+            continue;
+        }
+
+        const vector<Move> SOLUTION = solver.getSolution();
+        for( unsigned int i = 0; i <= SOLUTION.size(); ++i ) {
+            const bool HAS_CARDS = game.getSize( Pile::STOCK ) > 0 
+                || game.getSize( Pile::WASTE ) > 0;
+            if( !HAS_CARDS && !game.isWon() ) {
+                ++emptyDecks;
+            }
+
+            if( hasStockMove( game ) != ( HAS_CARDS && !game.isWon() ) ) {
+                cerr << "Deal " << deal << " after " << i << " moves: stock "
+                    << ( HAS_CARDS ? "not offered" : "offered" ) << endl;
+                isPassed = false;
+            }
+
+            if( i < SOLUTION.size() && !game.apply( SOLUTION[i] ) ) {
+                cerr << "Deal " << deal << ": move " << i << " of the solution is illegal" << endl;
+                isPassed = false;
+                break;
+            }
+        }
+    }
+
+    if( emptyDecks == 0 ) {
+        cerr << "No position with an empty deck was reached" << endl;
+        isPassed = false;
+    }
+
+    cout << "legal moves: " << (isPassed ? "passed" : "FAILED") << endl;
+    return isPassed ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * move allocation test, which checks that performing, undoing and redoing moves
+ * never allocates once the move journal has warmed up.
+ */
+
+#include <iostream>
+#include <new>
+using namespace std;
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "Klondike.h"
+#include "Move.h"
+#include "MoveJournal.h"
+
+/**
+ * @brief The amount of deals played through while allocations are counted
+ */
+const uint64_t DEAL_AMOUNT = 200;
+
+/**
+ * @brief The amount of moves, undos and redos made in each deal, which is
+ * fewer than the warmed up journal has room for
+ */
+const unsigned int STEP_AMOUNT = 600;
+
+/**
+ * @brief The amount of allocations made by the program so far
+ */
+static unsigned long allocationCount = 0;
+
+void* operator new( size_t size ) {
+    ++allocationCount;
+    void* pMemory = malloc( size > 0 ? size : 1 );
+    if( pMemory == nullptr ) {
+        throw bad_alloc();
+    }
+
+    return pMemory;
+}
+
+void operator delete( void* pMemory ) noexcept {
+    free( pMemory );
+}
+
+/**
+ * @brief Make random moves, undos and redos in a game. Every choice is
+ * made without the standard library, so that only the game and journal
+ * can allocate
+ * @param game The game to play
+ * @param journal The journal to record the moves in
+ * @param SEED The seed the choices are made from
+ * @param STEPS The amount of moves, undos and redos to make
+ */
+void play( Klondike& game, MoveJournal& journal, uint64_t seed, const unsigned int STEPS ) {
+    Move moves[Klondike::MAX_MOVES];
+    for( unsigned int i = 0; i < STEPS; ++i ) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const unsigned int CHOICE = (seed >> 33) % 10;
+
+        if( CHOICE < 2 ) {
+            journal.undo( game );
+        } else if( CHOICE < 3 ) {
+            journal.redo( game );
+        } else {
+            const unsigned int AMOUNT = game.getLegalMoves( moves, Klondike::MAX_MOVES );
+            if( AMOUNT > 0 ) {
+                journal.apply( game, moves[(seed >> 40) % AMOUNT] );
+            }
+        }
+    }
+}
+
+int main() {
+    MoveJournal journal;
+
+    // The first game grows the journal past anything the later games need
+    Klondike warmup( 0 );
+    play( warmup, journal, 0, STEP_AMOUNT * 4 );
+    journal.clear();
+
+    const unsigned long BEFORE = allocationCount;
+    for( uint64_t deal = 1; deal <= DEAL_AMOUNT; ++deal ) {
+        Klondike game( deal );
+        play( game, journal, deal, STEP_AMOUNT );
+        while( journal.undo( game ) ) {
+            // Undo the whole game, which is the longest undo there can be
+        }
+
+        journal.clear();
+    }
+
+    const unsigned long ALLOCATIONS = allocationCount - BEFORE;
+    if( ALLOCATIONS > 0 ) {
+        cerr << ALLOCATIONS << " allocations while playing " << DEAL_AMOUNT << " deals" << endl;
+    }
+
+    cout << "move allocations: " << (ALLOCATIONS == 0 ? "passed" : "FAILED") << endl;
+    return ALLOCATIONS == 0 ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * recount benchmark, which times summarizing a history on one thread against
+ * splitting it between several, and suggests how many games each thread needs.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "HistoryColumns.h"
+#include "HistoryRecord.h"
+#include "SolitaireInfo.h"
+#include "StatisticsSummary.h"
+
+/**
+ * @brief The amount of games in the largest history timed
+ */
+const unsigned long MAX_GAME_AMOUNT = 1 << 22;
+
+/**
+ * @brief The amount of times each timing is repeated, of which the fastest
+ * is kept
+ */
+const int REPEAT_AMOUNT = 5;
+
+/**
+ * @brief How much of the time of a part the cost of starting its thread
+ * may take up
+ */
+const double MAX_OVERHEAD = 0.1;
+
+/**
+ * @brief Where the games being summarized are kept, which is either
+ * history records or games held in memory
+ */
+struct GameSource {
+    const HistoryRecord* pRecords;
+    const HistoryColumns* pColumns;
+};
+
+/**
+ * @brief Summarize a range of games into a given summary, so that it can
+ * be run on a thread
+ * @param SOURCE The games to summarize
+ * @param BEGIN The position of the first game to summarize
+ * @param END The position after the last game to summarize
+ * @param pSummary The destination summary
+ */
+void summarize( 
+    const GameSource SOURCE, 
+    const unsigned long BEGIN, 
+    const unsigned long END, 
+    StatisticsSummary* pSummary 
+) {
+    if( SOURCE.pColumns != nullptr ) {
+        *pSummary = StatisticsSummary::fromColumns( *SOURCE.pColumns, BEGIN, END );
+    } else {
+        *pSummary = StatisticsSummary::fromRecords( SOURCE.pRecords + BEGIN, END - BEGIN );
+    }
+}
+
+/**
+ * @brief Summarize games split evenly between threads, the way the history
+ * does, but without any minimum part size
+ * @param SOURCE The games to summarize
+ * @param COUNT The amount of games
+ * @param PART_AMOUNT The amount of parts, each on a thread of its own
+ * except the first, which is summarized on the calling thread
+ * @return The summary of every game
+ */
+StatisticsSummary summarizeInParts( 
+    const GameSource SOURCE, 
+    const unsigned long COUNT, 
+    const unsigned int PART_AMOUNT 
+) {
+    vector<StatisticsSummary> summaries( PART_AMOUNT );
+    vector<thread> threads;
+    for( unsigned int i = 1; i < PART_AMOUNT; ++i ) {
+        threads.push_back( thread( 
+            summarize, 
+            SOURCE, 
+            COUNT * i / PART_AMOUNT, 
+            COUNT * (i + 1) / PART_AMOUNT, 
+            &summaries[i] 
+        ) );
+    }
+
+    summarize( SOURCE, 0, COUNT / PART_AMOUNT, &summaries[0] );
+    for( thread& t : threads ) {
+        t.join();
+    }
+
+    for( unsigned int i = 1; i < PART_AMOUNT; ++i ) {
+        summaries[0].append( summaries[i] );
+    }
+
+    return summaries[0];
+}
+
+/**
+ * @brief Time summarizing games, keeping the fastest of several runs
+ * @param SOURCE The games to summarize
+ * @param COUNT The amount of games
+ * @param PART_AMOUNT The amount of parts to split the games into
+ * @return The fastest time, in seconds
+ */
+double timeSummary( const GameSource SOURCE, const unsigned long COUNT, const unsigned int PART_AMOUNT ) {
+    double fastest = 0;
+    for( int i = 0; i < REPEAT_AMOUNT; ++i ) {
+        const chrono::steady_clock::time_point START = chrono::steady_clock::now();
+        const StatisticsSummary SUMMARY = summarizeInParts( SOURCE, COUNT, PART_AMOUNT );
+        const chrono::duration<double> ELAPSED = chrono::steady_clock::now() - START;
+
+        // Using the summary keeps it from being optimized away
+        if( SUMMARY.games != COUNT ) {
+            cerr << "Summarized " << SUMMARY.games << " of " << COUNT << " games" << endl;
+        }
+
+        if( i == 0 || ELAPSED.count() < fastest ) {
+            fastest = ELAPSED.count();
+        }
+    }
+
+    return fastest;
+}
+
+/**
+ * @brief Time starting and joining a thread that does nothing
+ * @return The average time, in seconds
+ */
+double timeThreadStart() {
+    const int AMOUNT = 1000;
+    const chrono::steady_clock::time_point START = chrono::steady_clock::now();
+    for( int i = 0; i < AMOUNT; ++i ) {
+        thread t( []() {} );
+        t.join();
+    }
+
+    const chrono::duration<double> ELAPSED = chrono::steady_clock::now() - START;
+    return ELAPSED.count() / AMOUNT;
+}
+
+/**
+ * @brief Time one kind of game source at every size, and suggest the
+ * fewest games a thread should be given
+ * @param NAME The name of the source
+ * @param SOURCE The games to summarize
+ * @param PART_AMOUNT The amount of parts to compare against one part
+ * @param THREAD_START The time it takes to start and join a thread
+ */
+void runBench( 
+    const char* NAME, 
+    const GameSource SOURCE, 
+    const unsigned int PART_AMOUNT, 
+    const double THREAD_START 
+) {
+    cout << NAME << ":" << endl;
+    cout << "    games  serial ms  " << PART_AMOUNT << " parts ms  speedup" << endl;
+    for( unsigned long count = 1 << 12; count <= MAX_GAME_AMOUNT; count *= 4 ) {
+        const double SERIAL = timeSummary( SOURCE, count, 1 );
+        const double PARALLEL = timeSummary( SOURCE, count, PART_AMOUNT );
+        cout << "    " << count 
+            << "  " << SERIAL * 1000 
+            << "  " << PARALLEL * 1000 
+            << "  " << SERIAL / PARALLEL << endl;
+    }
+
+    const double PER_GAME = timeSummary( SOURCE, MAX_GAME_AMOUNT, 1 ) / MAX_GAME_AMOUNT;
+    cout << "    " << PER_GAME * 1e9 << " ns per game, so a thread needs at least " 
+        << (unsigned long) (THREAD_START / MAX_OVERHEAD / PER_GAME) << " games" << endl;
+}
+
+int main() {
+    vector<HistoryRecord> records;
+    HistoryColumns columns;
+    records.reserve( MAX_GAME_AMOUNT );
+    columns.reserve( MAX_GAME_AMOUNT );
+
+    long time = 1300000000;
+    srand( 18 );
+    for( unsigned long i = 0; i < MAX_GAME_AMOUNT; ++i ) {
+        SolitaireInfo info;
+        info.win = rand() % 3 == 0;
+        info.moves = 60 + rand() % 250;
+        info.startTime = time + rand() % 600;
+        info.endTime = info.startTime + 60 + rand() % 600;
+        time = info.endTime;
+
+        records.push_back( HistoryRecord::fromInfo( info ) );
+        columns.add( info );
+    }
+
+    // Parts are compared even on a single core, where they show what
+    // splitting costs rather than what it saves
+    const unsigned int PART_AMOUNT = max( thread::hardware_concurrency(), 2u );
+    const double THREAD_START = timeThreadStart();
+    cout << "Starting a thread takes " << THREAD_START * 1e6 << " us, with " 
+        << thread::hardware_concurrency() << " cores" << endl;
+
+    runBench( "history records", GameSource { records.data(), nullptr }, PART_AMOUNT, THREAD_START );
+    runBench( "games in memory", GameSource { nullptr, &columns }, PART_AMOUNT, THREAD_START );
+    return 0;
+}
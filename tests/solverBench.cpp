@@ -0,0 +1,136 @@
+/* CSCI 200: Final Project
+ *
+ * Author: Alexander Capehart
+ * Resources used (Office Hours, Tutoring, Other Students, etc & in what capacity):
+ * - https://en.sfml-dev.org/forums/index.php?topic=10351.0 - Disable window resizing
+ * - https://cplusplus.com/reference/stack/stack/ - For stack usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1VertexArray.php - For vertex array usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Vector2.php - For vector usage
+ * - https://cplusplus.com/reference/list/list/ - For list usage
+ * - https://stackoverflow.com/questions/34314892/high-cpu-usage-of-simple-program - To reduce CPU usage
+ * - https://www.sfml-dev.org/tutorials/2.5/graphics-draw.php - For vertex array and renderstates usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Rect.php - For rect usage
+ * - https://www.sfml-dev.org/documentation/2.5.1/classsf_1_1Drawable.php - For drawable implementation
+ * - https://cplusplus.com/doc/tutorial/other_data_types/ for enum creation/usage
+ * - Learned about for-each loops from Professor Paone
+ * - Confirmed proper project formatting from Professor Paone
+ *
+ * This program implements a game of klondike solitaire. This file implements the
+ * solver benchmark, which measures how the search speed of the solver scales with
+ * the amount of threads it searches with.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "Klondike.h"
+#include "Move.h"
+#include "Solver.h"
+#include "SolverResult.h"
+
+/**
+ * @brief The amount of deals solved with every amount of threads
+ */
+const uint64_t DEAL_AMOUNT = 40;
+
+/**
+ * @brief The most nodes searched in each deal
+ */
+const unsigned long NODE_LIMIT = 100000;
+
+/**
+ * @brief Check that a solution wins the deal it was found for
+ * @param DEAL The deal
+ * @param SOLUTION The winning moves
+ * @return true if the moves are legal and win the game, false otherwise
+ */
+bool isSolution( const uint64_t DEAL, const vector<Move>& SOLUTION ) {
+    Klondike game( DEAL );
+    for( const Move MOVE : SOLUTION ) {
+        if( !game.apply( MOVE ) ) {
+            return false;
+        }
+    }
+
+    return game.isWon();
+}
+
+/**
+ * @brief Solve every deal with some amount of threads
+ * @param THREAD_AMOUNT The amount of threads to search with
+ * @param nodes Set to the amount of nodes searched
+ * @param wins Set to the amount of deals found to be winnable
+ * @return The time taken, in seconds, or a negative value if a solution
+ * that does not win was found
+ */
+double runSolver( const unsigned int THREAD_AMOUNT, unsigned long& nodes, unsigned long& wins ) {
+    Solver solver( NODE_LIMIT, THREAD_AMOUNT );
+    nodes = 0;
+    wins = 0;
+
+    double elapsed = 0;
+    for( uint64_t deal = 1; deal <= DEAL_AMOUNT; ++deal ) {
+        const Klondike GAME( deal );
+        const chrono::steady_clock::time_point START = chrono::steady_clock::now();
+        const SolverResult RESULT = solver.solve( GAME );
+        const chrono::duration<double> ELAPSED = chrono::steady_clock::now() - START;
+        elapsed += ELAPSED.count();
+        nodes += solver.getNodeCount();
+
+        if( RESULT == SolverResult::WINNABLE ) {
+            if( !isSolution( deal, solver.getSolution() ) ) {
+                cerr << "The solution found for deal " << deal << " with " 
+                    << THREAD_AMOUNT << " threads does not win" << endl;
+                return -1;
+            }
+
+            ++wins;
+        }
+    }
+
+    return elapsed;
+}
+
+int main( int argc, char* argv[] ) {
+    // Thread amounts past the amount of cores are only measured when asked
+    // for, as they show the cost of sharing the cores rather than scaling
+    unsigned int maxThreads = max( thread::hardware_concurrency(), 1u );
+    if( argc > 1 ) {
+        maxThreads = strtoul( argv[1], nullptr, 10 );
+    }
+
+    cout << "Solving " << DEAL_AMOUNT << " deals of up to " << NODE_LIMIT 
+        << " nodes, with " << thread::hardware_concurrency() << " cores" << endl;
+    cout << "    threads  wins  nodes  seconds  nodes/s  speedup" << endl;
+
+    double baseRate = 0;
+    for( unsigned int threads = 1; threads <= maxThreads; threads *= 2 ) {
+        unsigned long nodes;
+        unsigned long wins;
+        const double ELAPSED = runSolver( threads, nodes, wins );
+        if( ELAPSED < 0 ) {
+            return 1;
+        }
+
+        const double RATE = nodes / ELAPSED;
+        if( threads == 1 ) {
+            baseRate = RATE;
+        }
+
+        cout << "    " << threads 
+            << "  " << wins 
+            << "  " << nodes 
+            << "  " << ELAPSED 
+            << "  " << (unsigned long) RATE 
+            << "  " << RATE / baseRate << endl;
+    }
+
+    return 0;
+}